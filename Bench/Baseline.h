@@ -0,0 +1,334 @@
+// Baseline.h : 비교용으로 남겨 둔 최초 구현 (저장소 첫 커밋의 CSVParser/Main.cpp, TextRPG/JsonParser.h)
+// 지금 경로가 얼마나 빨라졌는지 같은 입력으로 나란히 재기 위한 것이라 동작도 그때 그대로다.
+// (getline 으로 줄을 나누므로 따옴표 안 줄바꿈은 잘못 나누고, JSON 의 \uXXXX 는 지원하지 않는다)
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../TextRPG/ItemBase.h"
+
+namespace baseline {
+
+// -------------------- CSVParser --------------------
+static inline std::string ltrim(std::string s) { s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char c) {return !std::isspace(c); })); return s; }
+static inline std::string rtrim(std::string s) { s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char c) {return !std::isspace(c); }).base(), s.end()); return s; }
+static inline std::string trim(std::string s) { return rtrim(ltrim(std::move(s))); }
+
+// 한 글자씩 보면서 필드마다 문자열을 새로 만든다
+inline std::vector<std::string> parseCsvLine(const std::string& line) {
+	std::vector<std::string> out;
+	std::string cur;
+	bool inQuotes = false;
+	for (size_t i = 0; i < line.size(); ++i) {
+		char c = line[i];
+		if (inQuotes) {
+			if (c == '"') {
+				if (i + 1 < line.size() && line[i + 1] == '"') { // "" -> "
+					cur.push_back('"'); ++i;
+				}
+				else {
+					inQuotes = false;
+				}
+			}
+			else {
+				cur.push_back(c);
+			}
+		}
+		else {
+			if (c == '"') { inQuotes = true; }
+			else if (c == ',') { out.push_back(cur); cur.clear(); }
+			else { cur.push_back(c); }
+		}
+	}
+	out.push_back(cur);
+	return out;
+}
+
+// loadCsv 의 줄 분리 부분 (인코딩 판별/변환 뒤)
+inline std::vector<std::vector<std::string>> splitCsvLines(const std::string& text) {
+	std::vector<std::vector<std::string>> cells;
+	std::istringstream iss(text);
+	std::string line;
+	while (std::getline(iss, line)) {
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		cells.push_back(parseCsvLine(line));
+	}
+	return cells;
+}
+
+inline std::string jsonEscape(const std::string& s) {
+	std::ostringstream oss;
+	for (unsigned char c : s) {
+		switch (c) {
+		case '\"': oss << "\\\""; break;
+		case '\\': oss << "\\\\"; break;
+		case '\b': oss << "\\b"; break;
+		case '\f': oss << "\\f"; break;
+		case '\n': oss << "\\n"; break;
+		case '\r': oss << "\\r"; break;
+		case '\t': oss << "\\t"; break;
+		default:
+			if (c < 0x20) {
+				oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c;
+			}
+			else {
+				oss << c;
+			}
+		}
+	}
+	return oss.str();
+}
+
+inline std::string jsonString(const std::string& s) { return std::string("\"") + jsonEscape(s) + "\""; }
+
+inline std::string jsonObject(const std::vector<std::pair<std::string, std::string>>& kvs) {
+	std::string out = "{";
+	for (size_t i = 0; i < kvs.size(); ++i) {
+		if (i) out += ',';
+		out += jsonString(kvs[i].first);
+		out += ':';
+		out += kvs[i].second;
+	}
+	out += "}";
+	return out;
+}
+
+inline std::string jsonArray(const std::vector<std::string>& elems) {
+	std::string out = "[";
+	for (size_t i = 0; i < elems.size(); ++i) {
+		if (i) out += ',';
+		out += elems[i];
+	}
+	out += "]";
+	return out;
+}
+
+// 행마다 컬럼명 → 값 map 을 만든다 (startCell 은 A2 고정: 헤더 한 줄 건너뜀)
+inline std::vector<std::unordered_map<std::string, std::string>> sliceTable(
+	const std::vector<std::vector<std::string>>& cells, const std::vector<std::string>& columns) {
+	std::vector<std::unordered_map<std::string, std::string>> rows;
+	for (size_t r = 1; r < cells.size(); ++r) {
+		const auto& row = cells[r];
+		std::string first = !row.empty() ? trim(row[0]) : "";
+		if (first.empty()) break;
+		std::unordered_map<std::string, std::string> obj;
+		bool allEmpty = true;
+		for (size_t c = 0; c < columns.size(); ++c) {
+			std::string val;
+			if (c < row.size()) val = trim(row[c]);
+			if (!val.empty()) allEmpty = false;
+			obj[columns[c]] = val;
+		}
+		if (allEmpty) break;
+		rows.push_back(std::move(obj));
+	}
+	return rows;
+}
+
+inline std::string toJson(const std::vector<std::unordered_map<std::string, std::string>>& rows) {
+	std::vector<std::string> arr;
+	arr.reserve(rows.size());
+	for (const auto& r : rows) {
+		std::vector<std::pair<std::string, std::string>> kv;
+		kv.reserve(r.size());
+		for (const auto& [k, v] : r) {
+			kv.push_back({ k, jsonString(v) });
+		}
+		std::sort(kv.begin(), kv.end(), [](auto& a, auto& b) {return a.first < b.first; });
+		arr.push_back(jsonObject(kv));
+	}
+	return jsonArray(arr);
+}
+
+// -------------------- TextRPG --------------------
+// 노드마다 vector/unordered_map 을 들고 있는 트리 DOM
+struct JsonValue {
+	enum Type { Null, Bool, Number, String, Array, Object };
+	Type type = Null;
+	double number = 0.0;
+	bool boolean = false;
+	std::string str;
+	std::vector<JsonValue> arr;
+	std::unordered_map<std::string, JsonValue> obj;
+
+	static JsonValue makeNull() { return JsonValue(); }
+	static JsonValue makeBool(bool b) { JsonValue v; v.type = Bool; v.boolean = b; return v; }
+	static JsonValue makeNumber(double d) { JsonValue v; v.type = Number; v.number = d; return v; }
+	static JsonValue makeString(const std::string& s) { JsonValue v; v.type = String; v.str = s; return v; }
+	static JsonValue makeArray() { JsonValue v; v.type = Array; return v; }
+	static JsonValue makeObject() { JsonValue v; v.type = Object; return v; }
+
+	const JsonValue* get(const std::string& key) const {
+		if (type != Object) return nullptr;
+		std::unordered_map<std::string, JsonValue>::const_iterator it = obj.find(key);
+		return it == obj.end() ? nullptr : &it->second;
+	}
+};
+
+struct JsonParser {
+	const std::string& s; size_t i, n;
+	explicit JsonParser(const std::string& src) : s(src), i(0), n(src.size()) {}
+
+	void skipWs() { while (i < n && std::isspace((unsigned char)s[i])) ++i; }
+	bool match(char c) { skipWs(); if (i < n && s[i] == c) { ++i; return true; } return false; }
+	void expect(char c) { skipWs(); if (i >= n || s[i] != c) throw std::runtime_error(std::string("expected '") + c + "'"); ++i; }
+
+	JsonValue parse() {
+		skipWs(); JsonValue v = parseValue(); skipWs();
+		if (i != n) throw std::runtime_error("extra characters after JSON");
+		return v;
+	}
+
+	JsonValue parseValue() {
+		skipWs(); if (i >= n) throw std::runtime_error("unexpected end");
+		char c = s[i];
+		if (c == '{') return parseObject();
+		if (c == '[') return parseArray();
+		if (c == '"') return parseString();
+		if (c == 't' || c == 'f') return parseBool();
+		if (c == 'n') return parseNull();
+		if (c == '-' || std::isdigit((unsigned char)c)) return parseNumber();
+		throw std::runtime_error(std::string("unexpected char: ") + c);
+	}
+
+	JsonValue parseObject() {
+		expect('{');
+		JsonValue v = JsonValue::makeObject();
+		skipWs();
+		if (match('}')) return v;
+		while (true) {
+			skipWs(); if (s[i] != '"') throw std::runtime_error("object key must be string");
+			std::string key = parseString().str;
+			skipWs(); expect(':');
+			JsonValue val = parseValue();
+			v.obj.insert(std::make_pair(key, val));
+			skipWs();
+			if (match('}')) break;
+			expect(',');
+		}
+		return v;
+	}
+
+	JsonValue parseArray() {
+		expect('[');
+		JsonValue v = JsonValue::makeArray();
+		skipWs();
+		if (match(']')) return v;
+		while (true) {
+			v.arr.push_back(parseValue());
+			skipWs();
+			if (match(']')) break;
+			expect(',');
+		}
+		return v;
+	}
+
+	JsonValue parseString() {
+		expect('"');
+		std::string out; out.reserve(32);
+		while (i < n) {
+			char c = s[i++];
+			if (c == '"') break;
+			if (c == '\\') {
+				if (i >= n) throw std::runtime_error("bad escape");
+				char e = s[i++];
+				switch (e) {
+				case '"': out.push_back('"'); break;
+				case '\\': out.push_back('\\'); break;
+				case '/': out.push_back('/'); break;
+				case 'b': out.push_back('\b'); break;
+				case 'f': out.push_back('\f'); break;
+				case 'n': out.push_back('\n'); break;
+				case 'r': out.push_back('\r'); break;
+				case 't': out.push_back('\t'); break;
+				default: throw std::runtime_error("unsupported escape (\\uXXXX omitted)");
+				}
+			}
+			else {
+				out.push_back(c);
+			}
+		}
+		return JsonValue::makeString(out);
+	}
+
+	JsonValue parseBool() {
+		if (i + 3 < n && s.compare(i, 4, "true") == 0) { i += 4; return JsonValue::makeBool(true); }
+		if (i + 4 < n && s.compare(i, 5, "false") == 0) { i += 5; return JsonValue::makeBool(false); }
+		throw std::runtime_error("bad boolean");
+	}
+
+	JsonValue parseNull() {
+		if (i + 3 < n && s.compare(i, 4, "null") == 0) { i += 4; return JsonValue::makeNull(); }
+		throw std::runtime_error("bad null");
+	}
+
+	JsonValue parseNumber() {
+		size_t start = i;
+		if (s[i] == '-') ++i;
+		if (i < n && s[i] == '0') { ++i; }
+		else {
+			if (i >= n || !std::isdigit((unsigned char)s[i])) throw std::runtime_error("bad number");
+			while (i < n && std::isdigit((unsigned char)s[i])) ++i;
+		}
+		if (i < n && s[i] == '.') {
+			++i; if (i >= n || !std::isdigit((unsigned char)s[i])) throw std::runtime_error("bad number frac");
+			while (i < n && std::isdigit((unsigned char)s[i])) ++i;
+		}
+		if (i < n && (s[i] == 'e' || s[i] == 'E')) {
+			++i; if (i < n && (s[i] == '+' || s[i] == '-')) ++i;
+			if (i >= n || !std::isdigit((unsigned char)s[i])) throw std::runtime_error("bad number exp");
+			while (i < n && std::isdigit((unsigned char)s[i])) ++i;
+		}
+		double val = std::strtod(s.substr(start, i - start).c_str(), nullptr);
+		return JsonValue::makeNumber(val);
+	}
+};
+
+// DataManager::LoadItemsJson (DOM 을 다 만든 뒤 키를 map 에서 찾아 ItemBase 로)
+inline void loadItemsJson(const JsonValue& root, std::vector<ItemBase>& out) {
+	out.clear();
+	if (root.type != JsonValue::Array)
+		return;
+
+	out.reserve(root.arr.size());
+	for (const auto& obj : root.arr) {
+		if (obj.type != JsonValue::Object)
+			continue;
+
+		ItemBase it;
+		const JsonValue* pIdx = obj.get("Idx");
+		if (pIdx) {
+			if (pIdx->type == JsonValue::String)
+				it.idx = static_cast<int>(std::strtol(pIdx->str.c_str(), nullptr, 10));
+			else if (pIdx->type == JsonValue::Number)
+				it.idx = static_cast<int>(pIdx->number);
+		}
+		const JsonValue* pName = obj.get("Name");
+		if (pName && pName->type == JsonValue::String)
+			it.name = pName->str;
+		const JsonValue* pEffect = obj.get("Effect");
+		if (pEffect && pEffect->type == JsonValue::String)
+			it.effect = pEffect->str;
+		const JsonValue* pType = obj.get("Type");
+		if (pType && pType->type == JsonValue::String)
+			it.type = ParseItemType(pType->str);
+		const JsonValue* pValue = obj.get("Value");
+		if (pValue) {
+			if (pValue->type == JsonValue::String)
+				it.value = static_cast<int>(std::strtol(pValue->str.c_str(), nullptr, 10));
+			else if (pValue->type == JsonValue::Number)
+				it.value = static_cast<int>(pValue->number);
+		}
+		out.push_back(it);
+	}
+}
+
+} // namespace baseline
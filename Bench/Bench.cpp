@@ -0,0 +1,48 @@
+// Bench.cpp : CSVParser / TextRPG 핫패스 마이크로벤치마크
+// 사용법: bench [--rows N] [--shop-rows M] [--iters K] [--seed S] [--filter 이름]
+//   N 은 1000 ~ 10000000 권장 (기본 100000), M 기본 N, K 기본 5
+// 입력은 SyntheticData.h 로 메모리에서 만들므로 파일 I/O 는 측정에 들어가지 않는다.
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "BenchUtil.h"
+
+int main(int argc, char** argv) {
+	size_t rows = 100000;
+	size_t shopRows = 0;
+	int iters = 5;
+	uint64_t seed = 1;
+	std::string filter;
+	for (int i = 1; i + 1 < argc; i += 2) {
+		std::string opt = argv[i];
+		std::string val = argv[i + 1];
+		if (opt == "--rows") rows = (size_t)std::strtoull(val.c_str(), nullptr, 10);
+		else if (opt == "--shop-rows") shopRows = (size_t)std::strtoull(val.c_str(), nullptr, 10);
+		else if (opt == "--iters") iters = std::atoi(val.c_str());
+		else if (opt == "--seed") seed = std::strtoull(val.c_str(), nullptr, 10);
+		else if (opt == "--filter") filter = val;
+		else {
+			std::cerr << "usage: bench [--rows N] [--shop-rows M] [--iters K] [--seed S] [--filter name]\n";
+			return 1;
+		}
+	}
+	if (!shopRows) shopRows = rows;
+
+	SyntheticSheet items = makeItemSheet(rows, seed);
+	SyntheticSheet shops = makeShopSheet(shopRows, rows, seed);
+	std::string itemJson = makeTypedJson(items);
+	std::string itemNdjson = makeTypedJson(items, true);
+	std::string shopJson = makeTypedJson(shops);
+	std::printf("items: %zu rows, csv %zu bytes, json %zu bytes\n", rows, items.csv.size(), itemJson.size());
+	std::printf("shops: %zu rows, csv %zu bytes, json %zu bytes\n", shopRows, shops.csv.size(), shopJson.size());
+	std::printf("best of %d\n\n", iters);
+
+	BenchRunner runner(iters, filter);
+	runner.printHeader();
+	runCsvBenchmarks(runner, items);
+	shops = SyntheticSheet(); // Shop 은 JSON 만 쓴다
+	runRpgBenchmarks(runner, itemJson, itemNdjson, rows, shopJson, shopRows);
+	return 0;
+}
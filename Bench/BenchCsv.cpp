@@ -0,0 +1,99 @@
+// BenchCsv.cpp : CSVParser 벤치마크 (CsvTokenizer, appendJsonEscaped, JsonTableWriter)
+// base/ 로 시작하는 항목은 같은 입력을 최초 구현(Baseline.h)으로 돌린 비교 기준이다.
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Baseline.h"
+#include "BenchUtil.h"
+#include "../CSVParser/ColumnTypes.h"
+#include "../CSVParser/CsvTokenizer.h"
+#include "../CSVParser/JsonWriter.h"
+
+std::string makeTypedJson(const SyntheticSheet& sheet, bool lines) {
+	ColumnTypeInfer infer(sheet.columns.size());
+	for (const auto& r : sheet.rows) infer.add(r);
+	JsonTableWriter w(sheet.columns, resolveColumnSpecs(sheet.columns.size(), {}, &infer), lines);
+	std::string out;
+	w.begin(out);
+	for (const auto& r : sheet.rows) w.writeRow(out, r);
+	w.end(out);
+	return out;
+}
+
+void runCsvBenchmarks(BenchRunner& runner, const SyntheticSheet& items) {
+	const size_t rows = items.rows.size();
+
+	// 레코드 단위 (토크나이저 하나로 레코드를 하나씩)
+	size_t recordBytes = 0;
+	for (const auto& rec : items.records) recordBytes += rec.size();
+	runner.run("CsvTokenizer(record)", recordBytes, rows, [&]() {
+		CsvTokenizer tok;
+		size_t fields = 0;
+		for (const auto& rec : items.records)
+			tok.tokenize(rec.data(), rec.size(), true, [&](const std::vector<std::string_view>& f) { fields += f.size(); });
+		return fields;
+	});
+
+	// 최초 loadCsv: getline 으로 줄을 나누고 줄마다 글자 단위 parseCsvLine
+	runner.run("base/getline+parseCsvLine", items.csv.size(), rows + 1, [&]() {
+		size_t fields = 0;
+		for (const auto& row : baseline::splitCsvLines(items.csv)) fields += row.size();
+		return fields;
+	});
+
+	// 버퍼 전체를 한 번에 (CSVParser 가 시트를 변환할 때와 같은 경로)
+	runner.run("CsvTokenizer::tokenize", items.csv.size(), rows + 1, [&]() {
+		CsvTokenizer tok;
+		size_t fields = 0;
+		tok.tokenize(items.csv.data(), items.csv.size(), true, [&](const std::vector<std::string_view>& f) {
+			fields += f.size();
+		});
+		return fields;
+	});
+
+	runner.run("base/jsonEscape", items.valueBytes(), rows, [&]() {
+		size_t out = 0;
+		for (const auto& r : items.rows)
+			for (const auto& v : r) out += baseline::jsonEscape(v).size();
+		return out;
+	});
+
+	runner.run("appendJsonEscaped", items.valueBytes(), rows, [&]() {
+		size_t out = 0;
+		std::string buf;
+		for (const auto& r : items.rows)
+			for (const auto& v : r) {
+				buf.clear();
+				appendJsonEscaped(buf, v);
+				out += buf.size();
+			}
+		return out;
+	});
+
+	// 최초 변환: 행마다 컬럼명 → 값 unordered_map 을 만들고, 정렬한 키/값 문자열을 이어 붙인다
+	std::vector<std::vector<std::string>> cells;
+	cells.reserve(rows + 1);
+	cells.push_back(items.columns);
+	cells.insert(cells.end(), items.rows.begin(), items.rows.end());
+	runner.run("base/sliceTable+toJson", items.valueBytes(), rows, [&]() {
+		return baseline::toJson(baseline::sliceTable(cells, items.columns)).size();
+	});
+	cells = std::vector<std::vector<std::string>>();
+
+	// 모든 값을 문자열로 (타입 지정 없음)
+	runner.run("JsonTableWriter(string)", items.valueBytes(), rows, [&]() {
+		JsonTableWriter w(items.columns);
+		std::string out;
+		w.begin(out);
+		for (const auto& r : items.rows) w.writeRow(out, r);
+		w.end(out);
+		return out.size();
+	});
+
+	std::string typed;
+	runner.run("JsonTableWriter(typed)", items.valueBytes(), rows, [&]() {
+		typed = makeTypedJson(items);
+		return typed.size();
+	});
+}
@@ -0,0 +1,47 @@
+// BenchRpg.cpp : TextRPG 벤치마크 (JsonParser::parse, TableLoader 의 LoadSchemaJson/LoadSchemaNdjson)
+// base/ 로 시작하는 항목은 최초 구현(Baseline.h)으로 같은 테이블을 읽는 비교 기준이다.
+#include <string>
+#include <vector>
+
+#include "Baseline.h"
+#include "BenchUtil.h"
+#include "../TextRPG/JsonParser.h"
+#include "../TextRPG/TableLoader.h"
+#include "../TextRPG/TableSchemas.h"
+
+void runRpgBenchmarks(BenchRunner& runner, const std::string& itemJson, const std::string& itemNdjson, size_t itemRows,
+	const std::string& shopJson, size_t shopRows) {
+	// 트리 DOM (JsonValue 노드마다 할당)
+	runner.run("JsonParser::parse", itemJson.size(), itemRows, [&]() {
+		JsonParser p(itemJson);
+		return p.parse().arr.size();
+	});
+
+	// 최초 부팅 경로: 트리 DOM 을 다 만든 뒤 객체마다 키를 찾아 ItemBase 로
+	runner.run("base/JsonParser+LoadItems", itemJson.size(), itemRows, [&]() {
+		baseline::JsonParser p(itemJson);
+		std::vector<ItemBase> items;
+		baseline::loadItemsJson(p.parse(), items);
+		return items.size();
+	});
+
+	// SAX → ItemBase 테이블 (부팅 시 실제 경로)
+	runner.run("LoadSchemaJson<Item>", itemJson.size(), itemRows, [&]() {
+		std::vector<ItemBase> items;
+		LoadSchemaJson<ItemSchema>(itemJson, items);
+		return items.size();
+	});
+
+	// 같은 테이블을 NDJSON 으로 (줄 경계로 나눠 코어 수만큼)
+	runner.run("LoadSchemaNdjson<Item>", itemNdjson.size(), itemRows, [&]() {
+		std::vector<ItemBase> items;
+		LoadSchemaNdjson<ItemSchema>(itemNdjson, items);
+		return items.size();
+	});
+
+	runner.run("LoadSchemaJson<Shop>", shopJson.size(), shopRows, [&]() {
+		std::vector<ShopBase> shops;
+		LoadSchemaJson<ShopSchema>(shopJson, shops);
+		return shops.size();
+	});
+}
@@ -0,0 +1,67 @@
+// BenchUtil.h : 마이크로벤치마크 실행/보고
+// 각 벤치마크는 같은 입력으로 여러 번 돌려 가장 빠른 회차를 기록하고,
+// 입력 바이트 기준 MB/s 와 행 기준 rows/s 로 보고한다.
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "SyntheticData.h"
+
+struct BenchResult {
+	std::string name;
+	double seconds = 0; // 가장 빠른 회차
+	size_t bytes = 0;   // 한 회차가 처리한 입력 바이트
+	size_t rows = 0;    // 한 회차가 처리한 행 수
+};
+
+class BenchRunner {
+public:
+	BenchRunner(int iterations, std::string filter) : iterations(iterations < 1 ? 1 : iterations), filter(std::move(filter)) {}
+
+	// fn 은 결과에서 뽑은 값(크기, 합계 등)을 돌려준다 → 컴파일러가 작업을 지우지 못하게 sink 에 더한다.
+	template <class Fn>
+	void run(const char* name, size_t bytes, size_t rows, Fn&& fn) {
+		if (!filter.empty() && std::string(name).find(filter) == std::string::npos) return;
+		BenchResult r;
+		r.name = name;
+		r.bytes = bytes;
+		r.rows = rows;
+		for (int k = 0; k < iterations; ++k) {
+			auto t0 = std::chrono::steady_clock::now();
+			sink += (size_t)fn();
+			double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+			if (k == 0 || s < r.seconds) r.seconds = s;
+		}
+		results.push_back(r);
+		printRow(r);
+	}
+
+	void printHeader() const {
+		std::printf("%-28s %10s %12s %10s %14s\n", "benchmark", "ms", "MB", "MB/s", "rows/s");
+	}
+
+private:
+	static void printRow(const BenchResult& r) {
+		double mb = r.bytes / (1024.0 * 1024.0);
+		double s = r.seconds > 0 ? r.seconds : 1e-9;
+		std::printf("%-28s %10.2f %12.2f %10.1f %14.0f\n", r.name.c_str(), r.seconds * 1000.0, mb, mb / s, r.rows / s);
+		std::fflush(stdout);
+	}
+
+	int iterations;
+	std::string filter;
+	std::vector<BenchResult> results;
+	volatile size_t sink = 0;
+};
+
+// -------------------- 벤치마크 묶음 --------------------
+// BenchCsv.cpp : CSVParser 쪽 (CSV 토큰화, JSON 직렬화)
+void runCsvBenchmarks(BenchRunner& runner, const SyntheticSheet& items);
+// CSVParser 와 같은 방식(타입 추론 후 JsonTableWriter)으로 만든 JSON (lines 면 NDJSON)
+std::string makeTypedJson(const SyntheticSheet& sheet, bool lines = false);
+
+// BenchRpg.cpp : TextRPG 쪽 (JSON 파싱, 테이블 로드)
+void runRpgBenchmarks(BenchRunner& runner, const std::string& itemJson, const std::string& itemNdjson, size_t itemRows,
+	const std::string& shopJson, size_t shopRows);
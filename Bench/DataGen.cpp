@@ -0,0 +1,76 @@
+// DataGen.cpp : 합성 Item.csv / Shop.csv 생성 (CSVParser 입력 폴더로 바로 쓸 수 있다)
+// 사용법: datagen <out_dir> [--rows N] [--shop-rows M] [--seed S]
+//   N 기본 100000 (Item), M 기본 N 의 4배 (Shop)
+// 행을 만드는 대로 파일에 쓰므로 메모리는 행 수와 무관하게 쓰기 버퍼 하나 정도만 쓴다.
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "SyntheticData.h"
+
+static const size_t kWriteBufferBytes = 1 << 20;
+
+// 헤더를 쓰고 generate(onRow) 가 넘기는 행을 버퍼가 찰 때마다 내보낸다
+template <class Generate>
+static bool writeCsv(const std::filesystem::path& path, const std::vector<std::string>& columns,
+	Generate&& generate, size_t& rows, size_t& bytes) {
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	std::string buf;
+	rows = bytes = 0;
+	auto flush = [&]() {
+		out.write(buf.data(), (std::streamsize)buf.size());
+		bytes += buf.size();
+		buf.clear();
+	};
+	appendCsvRecord(buf, columns);
+	buf += '\n';
+	generate([&](std::vector<std::string>&& row) {
+		appendCsvRecord(buf, row);
+		buf += '\n';
+		++rows;
+		if (buf.size() >= kWriteBufferBytes) flush();
+	});
+	flush();
+	return (bool)out;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		std::cerr << "usage: datagen <out_dir> [--rows N] [--shop-rows M] [--seed S]\n";
+		return 1;
+	}
+	std::filesystem::path outDir = argv[1];
+	size_t rows = 100000;
+	size_t shopRows = 0;
+	uint64_t seed = 1;
+	for (int i = 2; i + 1 < argc; i += 2) {
+		std::string opt = argv[i];
+		unsigned long long v = std::strtoull(argv[i + 1], nullptr, 10);
+		if (opt == "--rows") rows = (size_t)v;
+		else if (opt == "--shop-rows") shopRows = (size_t)v;
+		else if (opt == "--seed") seed = v;
+		else { std::cerr << "unknown option: " << opt << "\n"; return 1; }
+	}
+	if (!shopRows) shopRows = rows * 4;
+
+	std::error_code ec;
+	std::filesystem::create_directories(outDir, ec);
+
+	size_t written, bytes;
+	if (!writeCsv(outDir / "Item.csv", itemSheetColumns(),
+		[&](auto&& onRow) { generateItemRows(rows, seed, onRow); }, written, bytes)) {
+		std::cerr << "write failed: Item.csv\n";
+		return 1;
+	}
+	std::cout << "Item.csv: " << written << " rows, " << bytes << " bytes\n";
+
+	if (!writeCsv(outDir / "Shop.csv", shopSheetColumns(),
+		[&](auto&& onRow) { generateShopRows(shopRows, rows, seed, onRow); }, written, bytes)) {
+		std::cerr << "write failed: Shop.csv\n";
+		return 1;
+	}
+	std::cout << "Shop.csv: " << written << " rows, " << bytes << " bytes\n";
+	return 0;
+}
@@ -0,0 +1,138 @@
+// SyntheticData.h : 벤치마크용 Item/Shop 모양 시트 생성기
+// 실제 데이터 시트(Resources/*.csv)와 같은 컬럼 구성으로, 한글 이름과
+// 따옴표가 필요한 필드(쉼표, "", 줄바꿈 포함)를 섞어 만든다. 시드가 같으면 결과도 같다.
+// generate*Rows 는 행을 하나씩 콜백으로 넘기고(DataGen 이 바로 파일로 씀), make*Sheet 는 메모리에 모은다(벤치마크 입력).
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// -------------------- 난수 --------------------
+// 플랫폼마다 결과가 같아야 하므로 <random> 분포 대신 splitmix64 를 직접 쓴다.
+class SyntheticRng {
+public:
+	explicit SyntheticRng(uint64_t seed) : state(seed) {}
+
+	uint64_t next() {
+		uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+	// [0, n)
+	uint32_t below(uint32_t n) { return (uint32_t)(next() % n); }
+	// 확률 percent% 로 true
+	bool chance(uint32_t percent) { return below(100) < percent; }
+
+private:
+	uint64_t state;
+};
+
+// -------------------- 시트 --------------------
+struct SyntheticSheet {
+	std::vector<std::string> columns;
+	std::vector<std::vector<std::string>> rows; // 값 (헤더 제외)
+	std::vector<std::string> records;           // 행별 CSV 원문 (줄바꿈 제외)
+	std::string csv;                            // 헤더 포함 전체 CSV
+
+	size_t valueBytes() const {
+		size_t n = 0;
+		for (const auto& r : rows) for (const auto& v : r) n += v.size();
+		return n;
+	}
+};
+
+// 필요하면 따옴표로 감싸고 " 는 "" 로
+static inline void appendCsvField(std::string& out, const std::string& v) {
+	if (v.find_first_of(",\"\r\n") == std::string::npos) { out += v; return; }
+	out += '"';
+	for (char c : v) {
+		if (c == '"') out += '"';
+		out += c;
+	}
+	out += '"';
+}
+
+// 한 행의 CSV 원문 (줄바꿈 제외)
+static inline void appendCsvRecord(std::string& out, const std::vector<std::string>& row) {
+	for (size_t c = 0; c < row.size(); ++c) {
+		if (c) out += ',';
+		appendCsvField(out, row[c]);
+	}
+}
+
+static inline void addSyntheticRow(SyntheticSheet& sheet, std::vector<std::string> row) {
+	std::string rec;
+	appendCsvRecord(rec, row);
+	sheet.csv += rec;
+	sheet.csv += '\n';
+	sheet.records.push_back(std::move(rec));
+	sheet.rows.push_back(std::move(row));
+}
+
+static inline void beginSyntheticSheet(SyntheticSheet& sheet, std::vector<std::string> columns, size_t rows) {
+	sheet = SyntheticSheet();
+	sheet.columns = std::move(columns);
+	sheet.rows.reserve(rows);
+	sheet.records.reserve(rows);
+	appendCsvRecord(sheet.csv, sheet.columns);
+	sheet.csv += '\n';
+}
+
+static inline std::vector<std::string> itemSheetColumns() { return { "Idx", "Name", "Type", "Value", "Effect" }; }
+static inline std::vector<std::string> shopSheetColumns() { return { "ShopId", "ItemIdx", "Price", "Stock" }; }
+
+// Idx,Name,Type,Value,Effect  (Idx 는 1부터 연속). 행마다 onRow(std::vector<std::string>&&)
+// Name 은 한글 접두어 + 이름 + 번호. 약 5% 는 쉼표/따옴표/줄바꿈이 들어간 설명이 붙는다.
+template <class OnRow>
+static inline void generateItemRows(size_t rows, uint64_t seed, OnRow&& onRow) {
+	static const char* const prefixes[] = { "낡은 ", "빛나는 ", "전설의 ", "저주받은 ", "작은 ", "거대한 ", "", "" };
+	static const char* const names[] = { "회복 물약", "마나 물약", "강철 검", "나무 방패", "가죽 갑옷",
+		"불꽃 지팡이", "Elixir", "Potion", "얼음 반지", "용의 비늘" };
+	static const char* const quirks[] = { ", 한정판", " \"특급\"", "\n(이벤트)", ",\"세트\" 구성품" };
+	static const char* const types[] = { "Consume", "Equip", "Etc" };
+	static const char* const effects[] = { "Heal", "Mana", "IncreaseAttack", "IncreaseDefense", "None" };
+
+	SyntheticRng rng(seed);
+	for (size_t r = 0; r < rows; ++r) {
+		std::string name = prefixes[rng.below(8)];
+		name += names[rng.below(10)];
+		name += ' ';
+		name += std::to_string(r % 1000);
+		if (rng.chance(5)) name += quirks[rng.below(4)];
+		onRow(std::vector<std::string>{
+			std::to_string(r + 1),
+			std::move(name),
+			types[rng.below(3)],
+			std::to_string(rng.below(100000)),
+			effects[rng.below(5)] });
+	}
+}
+
+// ShopId,ItemIdx,Price,Stock  (ItemIdx 는 [1, itemRows] 범위, 상점당 평균 20개 품목)
+template <class OnRow>
+static inline void generateShopRows(size_t rows, size_t itemRows, uint64_t seed, OnRow&& onRow) {
+	SyntheticRng rng(seed ^ 0x5348u);
+	uint32_t items = itemRows ? (uint32_t)itemRows : 1;
+	for (size_t r = 0; r < rows; ++r) {
+		onRow(std::vector<std::string>{
+			std::to_string(r / 20 + 1),
+			std::to_string(rng.below(items) + 1),
+			std::to_string(10 + rng.below(50000)),
+			rng.chance(10) ? std::string("-1") : std::to_string(rng.below(100)) });
+	}
+}
+
+static inline SyntheticSheet makeItemSheet(size_t rows, uint64_t seed) {
+	SyntheticSheet sheet;
+	beginSyntheticSheet(sheet, itemSheetColumns(), rows);
+	generateItemRows(rows, seed, [&](std::vector<std::string>&& row) { addSyntheticRow(sheet, std::move(row)); });
+	return sheet;
+}
+
+static inline SyntheticSheet makeShopSheet(size_t rows, size_t itemRows, uint64_t seed) {
+	SyntheticSheet sheet;
+	beginSyntheticSheet(sheet, shopSheetColumns(), rows);
+	generateShopRows(rows, itemRows, seed, [&](std::vector<std::string>&& row) { addSyntheticRow(sheet, std::move(row)); });
+	return sheet;
+}
@@ -0,0 +1,186 @@
+// BinTableWriter.h : 시트 → 바이너리 테이블(.bin) 직렬화 (--format bin)
+// 레이아웃은 TextRPG/BinTableFormat.h 참고. 컬럼별 고정폭 배열 + 문자열 힙.
+// 고정폭 컬럼은 행 수를 알아야 배치할 수 있으므로 컬럼 데이터는 메모리에 모았다가 save 에서 쓴다.
+// (문자열은 힙에서 중복 제거 → "Heal" 같은 반복 값은 한 번만 저장)
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ColumnTypes.h"
+#include "../TextRPG/BinTableFormat.h"
+
+class BinTableWriter {
+public:
+	BinTableWriter(const std::vector<std::string>& columns, const std::vector<ColumnSpec>& types)
+		: names(columns), cols(columns.size()) {
+		for (size_t c = 0; c < cols.size(); ++c) {
+			ColumnType t = c < types.size() ? types[c].type : ColumnType::String;
+			cols[c].spec = c < types.size() ? types[c] : ColumnSpec();
+			switch (t) {
+			case ColumnType::Int: cols[c].type = BCT_INT; break;
+			case ColumnType::Float: cols[c].type = BCT_FLOAT; break;
+			case ColumnType::Bool: cols[c].type = BCT_BOOL; break;
+			default: cols[c].type = BCT_STRING; break; // String, Enum(Auto 는 호출자가 해소)
+			}
+		}
+	}
+
+	// values[c] 는 columns[c] 의 값. 타입과 맞지 않으면 runtime_error.
+	template <class Row>
+	void writeRow(const Row& values) {
+		for (size_t c = 0; c < cols.size(); ++c) writeValue(c, values[c]);
+		++rowCount;
+	}
+
+	size_t rows() const { return rowCount; }
+
+	bool save(std::ostream& os) {
+		std::vector<BinColumnDesc> descs(cols.size());
+		for (size_t c = 0; c < cols.size(); ++c) {
+			descs[c] = BinColumnDesc();
+			BinStringRef name = intern(names[c]);
+			descs[c].nameOffset = name.offset;
+			descs[c].nameLength = name.length;
+			descs[c].type = cols[c].type;
+		}
+
+		uint64_t off = align8(sizeof(BinTableHeader) + sizeof(BinColumnDesc) * descs.size());
+		for (size_t c = 0; c < cols.size(); ++c) {
+			descs[c].dataOffset = off;
+			off = align8(off + cols[c].data.size());
+			if (cols[c].hasNull) {
+				descs[c].nullOffset = off;
+				off = align8(off + cols[c].nulls.size());
+			}
+		}
+
+		BinTableHeader h = BinTableHeader();
+		std::memcpy(h.magic, BIN_TABLE_MAGIC, sizeof(h.magic));
+		h.version = BIN_TABLE_VERSION;
+		h.headerSize = sizeof(BinTableHeader);
+		h.columnCount = (uint32_t)cols.size();
+		h.rowCount = rowCount;
+		h.columnsOffset = sizeof(BinTableHeader);
+		h.heapOffset = off;
+		h.heapSize = heap.size();
+		h.fileSize = off + heap.size();
+
+		uint64_t pos = 0;
+		auto put = [&](const void* p, size_t n) { os.write(static_cast<const char*>(p), (std::streamsize)n); pos += n; };
+		auto padTo = [&](uint64_t target) { static const char zero[8] = {}; while (pos < target) put(zero, (size_t)std::min<uint64_t>(8, target - pos)); };
+		put(&h, sizeof(h));
+		if (!descs.empty()) put(descs.data(), sizeof(BinColumnDesc) * descs.size());
+		for (size_t c = 0; c < cols.size(); ++c) {
+			padTo(descs[c].dataOffset);
+			put(cols[c].data.data(), cols[c].data.size());
+			if (cols[c].hasNull) {
+				padTo(descs[c].nullOffset);
+				put(cols[c].nulls.data(), cols[c].nulls.size());
+			}
+		}
+		padTo(h.heapOffset);
+		put(heap.data(), heap.size());
+		return (bool)os;
+	}
+
+private:
+	struct Column {
+		ColumnSpec spec;
+		uint8_t type = BCT_STRING;
+		std::vector<char> data;   // 고정폭 값들
+		std::vector<char> nulls;  // null 비트맵(처음 null 이 나올 때 만든다)
+		bool hasNull = false;
+	};
+
+	static uint64_t align8(uint64_t v) { return (v + 7) & ~7ull; }
+
+	template <class T>
+	static void append(std::vector<char>& dst, const T& v) {
+		size_t at = dst.size();
+		dst.resize(at + sizeof(T));
+		std::memcpy(dst.data() + at, &v, sizeof(T));
+	}
+
+	// 이미 있는 값은 view 로 찾으므로 셀마다 문자열을 만들지 않는다(새 값일 때만 복사).
+	BinStringRef intern(std::string_view s) {
+		auto it = heapIndex.find(s);
+		if (it != heapIndex.end()) return it->second;
+		if (heap.size() + s.size() > UINT32_MAX) throw std::runtime_error("string heap exceeds 4 GiB");
+		BinStringRef r{ (uint32_t)heap.size(), (uint32_t)s.size() };
+		heap.insert(heap.end(), s.begin(), s.end());
+		heapKeys.emplace_back(s);
+		heapIndex.emplace(heapKeys.back(), r);
+		return r;
+	}
+
+	void markNull(Column& col) {
+		if (!col.hasNull) { col.nulls.assign((rowCount + 8) / 8, 0); col.hasNull = true; }
+		col.nulls.resize(rowCount / 8 + 1, 0);
+		col.nulls[rowCount / 8] |= (char)(1u << (rowCount % 8));
+	}
+
+	void writeValue(size_t c, std::string_view v) {
+		Column& col = cols[c];
+		if (col.hasNull) col.nulls.resize(rowCount / 8 + 1, 0);
+		if (col.type != BCT_STRING && v.empty()) {
+			markNull(col);
+			switch (col.type) {
+			case BCT_INT: append(col.data, (int64_t)0); break;
+			case BCT_FLOAT: append(col.data, 0.0); break;
+			default: append(col.data, (uint8_t)0); break;
+			}
+			return;
+		}
+		switch (col.type) {
+		case BCT_INT: {
+			if (!isIntLiteral(v)) typeError(c, v);
+			int64_t x = 0;
+			std::from_chars(v.data(), v.data() + v.size(), x); // isIntLiteral 로 범위까지 확인됨
+			append(col.data, x);
+			break;
+		}
+		case BCT_FLOAT: {
+			if (!isFloatLiteral(v)) typeError(c, v);
+			append(col.data, std::strtod(std::string(v).c_str(), nullptr));
+			break;
+		}
+		case BCT_BOOL: {
+			bool b = false;
+			if (!parseBoolLiteral(v, b)) typeError(c, v);
+			append(col.data, (uint8_t)(b ? 1 : 0));
+			break;
+		}
+		default: {
+			if (col.spec.type == ColumnType::Enum && !v.empty()) { // 빈 칸은 "" 로 저장
+				bool ok = false;
+				for (const auto& e : col.spec.enumValues) if (v == e) { ok = true; break; }
+				if (!ok) typeError(c, v);
+			}
+			append(col.data, intern(v));
+			break;
+		}
+		}
+	}
+
+	[[noreturn]] void typeError(size_t c, std::string_view v) const {
+		throw std::runtime_error("column '" + names[c] + "': \"" + std::string(v)
+			+ "\" is not " + columnTypeName(cols[c].spec.type));
+	}
+
+	std::vector<std::string> names;
+	std::vector<Column> cols;
+	std::vector<char> heap;
+	std::deque<std::string> heapKeys; // heapIndex 키가 가리키는 저장소(주소가 바뀌지 않는다)
+	std::unordered_map<std::string_view, BinStringRef> heapIndex;
+	uint64_t rowCount = 0;
+};
@@ -0,0 +1,145 @@
+// ColumnTypes.h : 컬럼 타입(int/float/bool/string/enum)과 자동 추론
+// 타입이 정해진 컬럼은 JSON 숫자/불리언으로 그대로 쓰고(따옴표 없음),
+// 런타임 로더가 문자열 → 숫자 변환을 하지 않아도 되게 한다.
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class ColumnType { Auto, Int, Float, Bool, String, Enum };
+
+struct ColumnSpec {
+	ColumnType type = ColumnType::Auto;
+	std::vector<std::string> enumValues; // Enum 일 때 허용 값
+};
+
+// "int" | "float" | "bool" | "string" | "auto" | "enum:A|B|C"
+static inline bool parseColumnSpec(const std::string& s, ColumnSpec& out) {
+	out = ColumnSpec();
+	if (s == "auto") out.type = ColumnType::Auto;
+	else if (s == "int") out.type = ColumnType::Int;
+	else if (s == "float") out.type = ColumnType::Float;
+	else if (s == "bool") out.type = ColumnType::Bool;
+	else if (s == "string") out.type = ColumnType::String;
+	else if (s.rfind("enum:", 0) == 0) {
+		out.type = ColumnType::Enum;
+		size_t p = 5;
+		while (p <= s.size()) {
+			size_t q = s.find('|', p);
+			if (q == std::string::npos) q = s.size();
+			if (q > p) out.enumValues.push_back(s.substr(p, q - p));
+			p = q + 1;
+		}
+	}
+	else return false;
+	return true;
+}
+
+static inline const char* columnTypeName(ColumnType t) {
+	switch (t) {
+	case ColumnType::Int: return "int";
+	case ColumnType::Float: return "float";
+	case ColumnType::Bool: return "bool";
+	case ColumnType::String: return "string";
+	case ColumnType::Enum: return "enum";
+	default: return "auto";
+	}
+}
+
+// -------------------- 값 분류 --------------------
+// JSON 정수 문법(-?(0|[1-9][0-9]*)) + int64 범위. "007" 같은 코드는 문자열로 남긴다.
+static inline bool isIntLiteral(std::string_view v) {
+	size_t i = 0, n = v.size();
+	if (i < n && v[i] == '-') ++i;
+	if (i >= n) return false;
+	if (v[i] == '0') return i + 1 == n;
+	size_t digits = n - i;
+	for (; i < n; ++i) if (v[i] < '0' || v[i] > '9') return false;
+	if (digits < 19) return true;
+	if (digits > 19) return false;
+	std::string_view mag = v.substr(v.size() - 19);
+	return mag <= (v[0] == '-' ? std::string_view("9223372036854775808") : std::string_view("9223372036854775807"));
+}
+
+// JSON 숫자 문법 그대로(앞의 +, .5, inf/nan 불가) → 출력에 원문을 그대로 써도 된다.
+static inline bool isFloatLiteral(std::string_view v) {
+	size_t i = 0, n = v.size();
+	auto digits = [&]() { size_t s = i; while (i < n && v[i] >= '0' && v[i] <= '9') ++i; return i > s; };
+	if (i < n && v[i] == '-') ++i;
+	if (i < n && v[i] == '0') ++i;
+	else if (!digits()) return false;
+	if (i < n && v[i] == '.') { ++i; if (!digits()) return false; }
+	if (i < n && (v[i] == 'e' || v[i] == 'E')) {
+		++i;
+		if (i < n && (v[i] == '+' || v[i] == '-')) ++i;
+		if (!digits()) return false;
+	}
+	return i == n;
+}
+
+// 정수 모양인데 int64 밖인 값 (isFloatLiteral 을 통과한 값에만 쓴다).
+// 추론에서 float 로 받으면 큰 ID 가 double 로 반올림되므로 문자열로 남긴다.
+static inline bool isWideIntLiteral(std::string_view v) {
+	return v.find_first_of(".eE") == std::string_view::npos && !isIntLiteral(v);
+}
+
+// true/false (엑셀의 TRUE/FALSE 포함). 결과는 b 에.
+static inline bool parseBoolLiteral(std::string_view v, bool& b) {
+	if (v == "true" || v == "TRUE" || v == "True") { b = true; return true; }
+	if (v == "false" || v == "FALSE" || v == "False") { b = false; return true; }
+	return false;
+}
+
+// -------------------- 자동 추론 --------------------
+// 컬럼별로 "아직 가능한 타입" 비트를 지워 가며, 끝나면 가장 좁은 타입을 고른다(Bool > Int > Float > String).
+// 빈 칸은 추론에 영향을 주지 않는다(출력은 null). int64 를 넘는 정수가 있으면 String.
+class ColumnTypeInfer {
+public:
+	explicit ColumnTypeInfer(size_t columnCount) : possible(columnCount, AllBits), seen(columnCount, 0) {}
+
+	template <class Row>
+	void add(const Row& values) {
+		for (size_t c = 0; c < possible.size(); ++c) {
+			std::string_view v = values[c];
+			if (v.empty() || possible[c] == 0) continue;
+			seen[c] = 1;
+			bool b;
+			if ((possible[c] & BoolBit) && !parseBoolLiteral(v, b)) possible[c] &= ~BoolBit;
+			if ((possible[c] & IntBit) && !isIntLiteral(v)) possible[c] &= ~IntBit;
+			if ((possible[c] & FloatBit) && (!isFloatLiteral(v) || isWideIntLiteral(v))) possible[c] &= ~FloatBit;
+		}
+	}
+
+	ColumnType result(size_t c) const {
+		if (!seen[c]) return ColumnType::String;
+		if (possible[c] & BoolBit) return ColumnType::Bool;
+		if (possible[c] & IntBit) return ColumnType::Int;
+		if (possible[c] & FloatBit) return ColumnType::Float;
+		return ColumnType::String;
+	}
+
+private:
+	enum : uint8_t { BoolBit = 1, IntBit = 2, FloatBit = 4, AllBits = 7 };
+	std::vector<uint8_t> possible;
+	std::vector<char> seen;
+};
+
+// specs(설정)를 바탕으로 최종 타입을 정한다. Auto 컬럼은 infer 결과(없으면 String).
+static inline std::vector<ColumnSpec> resolveColumnSpecs(size_t columnCount,
+	const std::vector<ColumnSpec>& specs, const ColumnTypeInfer* infer) {
+	std::vector<ColumnSpec> out(columnCount);
+	for (size_t c = 0; c < columnCount; ++c) {
+		if (c < specs.size()) out[c] = specs[c];
+		if (out[c].type == ColumnType::Auto)
+			out[c].type = infer ? infer->result(c) : ColumnType::String;
+	}
+	return out;
+}
+
+static inline bool needsInference(const std::vector<ColumnSpec>& specs, size_t columnCount) {
+	for (size_t c = 0; c < columnCount; ++c)
+		if (c >= specs.size() || specs[c].type == ColumnType::Auto) return true;
+	return false;
+}
@@ -0,0 +1,163 @@
+// ConvertStats.h : 시트 변환 단계별 시간/카운터 (--stats, --stats=json)
+// 단계: 읽기 → 인코딩 판별/변환 → 토큰화 → 슬라이스 → 타입 추론 → 직렬화 → 쓰기 (+ 매니페스트 해시)
+// 단계가 중첩되면(스트리밍에서 토큰화 콜백 안의 슬라이스/직렬화) 안쪽 시간은 바깥 단계에서 빠진다.
+// 단계가 바뀔 때마다 지난 구간을 직전 단계에 더하는 방식이라 합계가 시트 전체 시간과 맞는다.
+// 통계를 끄면 SheetStats 포인터가 nullptr 이고, StatScope/statAdd 는 분기 하나로 끝난다.
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "JsonWriter.h" // appendJsonEscaped
+
+enum class StatPhase { Read, Decode, Tokenize, Slice, Infer, Serialize, Write, Hash, Count };
+
+static inline const char* statPhaseName(StatPhase p) {
+	static const char* const names[] = { "read", "decode", "tokenize", "slice", "infer", "serialize", "write", "hash" };
+	return names[(size_t)p];
+}
+
+// 현재 스레드의 누적 할당 횟수. Main.cpp 의 operator new 가 올린다.
+inline thread_local uint64_t tlsAllocCount = 0;
+
+struct PhaseStats {
+	double seconds = 0;
+	uint64_t bytes = 0;  // 단계 입력(쓰기는 출력) 바이트
+	uint64_t rows = 0;
+	uint64_t cells = 0;
+	uint64_t allocs = 0; // operator new 호출 수
+};
+
+// 시트 하나의 통계. 한 스레드에서만 갱신한다(시트는 워커 하나가 끝까지 처리).
+class SheetStats {
+public:
+	std::string sheet;
+	std::string status;   // ok | uptodate | skip | error
+	bool streamed = false;
+	double totalSeconds = 0;
+	PhaseStats phases[(size_t)StatPhase::Count];
+
+	void begin() {
+		start = last = Clock::now();
+		lastAlloc = tlsAllocCount;
+		current = StatPhase::Count;
+	}
+	void finish() {
+		enter(StatPhase::Count);
+		totalSeconds = std::chrono::duration<double>(last - start).count();
+	}
+
+	// 지금까지의 구간을 현재 단계에 더하고 p 로 바꾼다. 이전 단계를 돌려준다.
+	StatPhase enter(StatPhase p) {
+		Clock::time_point now = Clock::now();
+		uint64_t allocs = tlsAllocCount;
+		if (current != StatPhase::Count) {
+			PhaseStats& ps = phases[(size_t)current];
+			ps.seconds += std::chrono::duration<double>(now - last).count();
+			ps.allocs += allocs - lastAlloc;
+		}
+		last = now;
+		lastAlloc = allocs;
+		StatPhase prev = current;
+		current = p;
+		return prev;
+	}
+
+	void add(StatPhase p, uint64_t bytes, uint64_t rows, uint64_t cells) {
+		PhaseStats& ps = phases[(size_t)p];
+		ps.bytes += bytes;
+		ps.rows += rows;
+		ps.cells += cells;
+	}
+
+private:
+	typedef std::chrono::steady_clock Clock;
+	Clock::time_point start, last;
+	uint64_t lastAlloc = 0;
+	StatPhase current = StatPhase::Count;
+};
+
+// 블록 동안 phase 로 집계하고, 끝나면 이전 단계로 돌아간다.
+class StatScope {
+public:
+	StatScope(SheetStats* stats, StatPhase phase) : stats(stats) {
+		if (stats) prev = stats->enter(phase);
+	}
+	~StatScope() {
+		if (stats) stats->enter(prev);
+	}
+	StatScope(const StatScope&) = delete;
+	StatScope& operator=(const StatScope&) = delete;
+
+private:
+	SheetStats* stats;
+	StatPhase prev = StatPhase::Count;
+};
+
+static inline void statAdd(SheetStats* stats, StatPhase p, uint64_t bytes, uint64_t rows = 0, uint64_t cells = 0) {
+	if (stats) stats->add(p, bytes, rows, cells);
+}
+
+// -------------------- 보고 --------------------
+// 사람이 읽는 표 (stderr 용)
+static inline void printStatsText(std::ostream& os, const std::vector<SheetStats>& sheets, double wallSeconds) {
+	char line[160];
+	for (const SheetStats& s : sheets) {
+		if (s.status == "skip") continue;
+		std::snprintf(line, sizeof(line), "[Stats] %s (%s%s) %.3f ms\n", s.sheet.c_str(), s.status.c_str(),
+			s.streamed ? ", streamed" : "", s.totalSeconds * 1000.0);
+		os << line;
+		for (size_t p = 0; p < (size_t)StatPhase::Count; ++p) {
+			const PhaseStats& ps = s.phases[p];
+			if (ps.seconds == 0 && ps.bytes == 0 && ps.rows == 0) continue;
+			double mbps = ps.seconds > 0 ? ps.bytes / (1024.0 * 1024.0) / ps.seconds : 0;
+			std::snprintf(line, sizeof(line), "  %-10s %10.3f ms %12llu B %9.1f MB/s %10llu rows %11llu cells",
+				statPhaseName((StatPhase)p), ps.seconds * 1000.0, (unsigned long long)ps.bytes, mbps,
+				(unsigned long long)ps.rows, (unsigned long long)ps.cells);
+			os << line;
+			std::snprintf(line, sizeof(line), " %10llu allocs\n", (unsigned long long)ps.allocs);
+			os << line;
+		}
+	}
+	std::snprintf(line, sizeof(line), "[Stats] total %.3f ms\n", wallSeconds * 1000.0);
+	os << line;
+}
+
+// 대시보드용 JSON. 형식이 바뀌면 "version" 을 올린다.
+static inline void writeStatsJson(std::ostream& os, const std::vector<SheetStats>& sheets, double wallSeconds, unsigned jobs) {
+	char num[64];
+	auto seconds = [&](double s) { std::snprintf(num, sizeof(num), "%.6f", s); return num; };
+	std::string out = "{\"version\":1,\"jobs\":" + std::to_string(jobs) + ",\"totalSeconds\":";
+	out += seconds(wallSeconds);
+	out += ",\"sheets\":[";
+	for (size_t i = 0; i < sheets.size(); ++i) {
+		const SheetStats& s = sheets[i];
+		if (i) out += ',';
+		out += "{\"sheet\":\"";
+		appendJsonEscaped(out, s.sheet);
+		out += "\",\"status\":\"" + s.status + "\",\"streamed\":";
+		out += s.streamed ? "true" : "false";
+		out += ",\"totalSeconds\":";
+		out += seconds(s.totalSeconds);
+		out += ",\"phases\":{";
+		for (size_t p = 0; p < (size_t)StatPhase::Count; ++p) {
+			const PhaseStats& ps = s.phases[p];
+			if (p) out += ',';
+			out += '"';
+			out += statPhaseName((StatPhase)p);
+			out += "\":{\"seconds\":";
+			out += seconds(ps.seconds);
+			out += ",\"bytes\":" + std::to_string(ps.bytes);
+			out += ",\"rows\":" + std::to_string(ps.rows);
+			out += ",\"cells\":" + std::to_string(ps.cells);
+			out += ",\"allocs\":" + std::to_string(ps.allocs);
+			out += '}';
+		}
+		out += "}}";
+	}
+	out += "]}\n";
+	os << out;
+}
@@ -0,0 +1,302 @@
+// CsvTokenizer.h : 블록 단위(64바이트) 비트마스크 CSV 토크나이저
+// - AVX2(32바이트 x2) / SSE2(16바이트 x4) / 스칼라 경로를 컴파일 타임에 선택
+// - 따옴표 비트마스크의 prefix-XOR 로 "따옴표 안" 영역을 구한 뒤,
+//   따옴표 밖의 콤마/개행 비트만 필드 경계로 사용한다.
+// - 따옴표가 없는 필드는 입력 버퍼를 그대로 가리키고(string_view),
+//   따옴표가 있는 필드만 스칼라로 풀어낸다("" -> ").
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CSV_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CSV_SIMD_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// -------------------- 비트 유틸 --------------------
+static inline unsigned csvCtz64(uint64_t x) {
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long idx; _BitScanForward64(&idx, x); return (unsigned)idx;
+#elif defined(_MSC_VER)
+	unsigned long idx;
+	if (_BitScanForward(&idx, (unsigned long)x)) return (unsigned)idx;
+	_BitScanForward(&idx, (unsigned long)(x >> 32)); return (unsigned)idx + 32;
+#else
+	return (unsigned)__builtin_ctzll(x);
+#endif
+}
+
+// 각 비트 위치까지의 누적 XOR. 여는 따옴표 ~ 닫는 따옴표 직전까지가 1이 된다.
+static inline uint64_t csvPrefixXor(uint64_t x) {
+	x ^= x << 1; x ^= x << 2; x ^= x << 4;
+	x ^= x << 8; x ^= x << 16; x ^= x << 32;
+	return x;
+}
+
+// [lo, hi) 비트 구간 마스크 (0 <= lo <= hi <= 64)
+static inline uint64_t csvRangeMask(unsigned lo, unsigned hi) {
+	uint64_t h = (hi >= 64) ? ~0ull : ((1ull << hi) - 1);
+	uint64_t l = (lo >= 64) ? ~0ull : ((1ull << lo) - 1);
+	return h & ~l;
+}
+
+// -------------------- 64바이트 블록 스캔 --------------------
+struct CsvBlockMasks {
+	uint64_t quote = 0;
+	uint64_t comma = 0;
+	uint64_t newline = 0;
+};
+
+// p 에서 64바이트를 읽을 수 있어야 한다.
+static inline CsvBlockMasks csvScanBlock(const char* p) {
+	CsvBlockMasks m;
+#if defined(CSV_SIMD_AVX2)
+	const __m256i q = _mm256_set1_epi8('"');
+	const __m256i c = _mm256_set1_epi8(',');
+	const __m256i nl = _mm256_set1_epi8('\n');
+	for (int k = 0; k < 2; ++k) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * k));
+		int sh = 32 * k;
+		m.quote |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, q)) << sh;
+		m.comma |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, c)) << sh;
+		m.newline |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, nl)) << sh;
+	}
+#elif defined(CSV_SIMD_SSE2)
+	const __m128i q = _mm_set1_epi8('"');
+	const __m128i c = _mm_set1_epi8(',');
+	const __m128i nl = _mm_set1_epi8('\n');
+	for (int k = 0; k < 4; ++k) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+		int sh = 16 * k;
+		m.quote |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, q)) << sh;
+		m.comma |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, c)) << sh;
+		m.newline |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, nl)) << sh;
+	}
+#else
+	for (int k = 0; k < 64; ++k) {
+		uint64_t bit = 1ull << k;
+		switch (p[k]) {
+		case '"': m.quote |= bit; break;
+		case ',': m.comma |= bit; break;
+		case '\n': m.newline |= bit; break;
+		default: break;
+		}
+	}
+#endif
+	return m;
+}
+
+// -------------------- 따옴표 필드 해제 --------------------
+// 최초 parseCsvLine 과 같은 규칙: 따옴표는 상태만 토글하고, 따옴표 안의 "" 는 " 로.
+// out 에 쓴 바이트 수를 돌려준다(항상 len 이하). 앞에서부터 쓰므로 out == s 여도 된다.
+static inline size_t csvUnquote(const char* s, size_t len, char* out) {
+	size_t o = 0;
+	bool inQuotes = false;
+	for (size_t i = 0; i < len; ++i) {
+		char c = s[i];
+		if (inQuotes) {
+			if (c == '"') {
+				if (i + 1 < len && s[i + 1] == '"') { out[o++] = '"'; ++i; }
+				else inQuotes = false;
+			}
+			else out[o++] = c;
+		}
+		else {
+			if (c == '"') inQuotes = true;
+			else out[o++] = c;
+		}
+	}
+	return o;
+}
+
+// -------------------- 토크나이저 --------------------
+// 한 행이 끝날 때마다 onRow(const std::vector<std::string_view>& fields) 호출.
+// 필드 view 는 입력 버퍼나 내부 scratch 를 가리키므로 콜백 안에서만 유효하다.
+// (tokenizeInPlace 는 scratch 를 쓰지 않으므로 입력 버퍼가 살아 있는 동안 유효)
+class CsvTokenizer {
+public:
+	// data[0, n) 을 토큰화한다.
+	// last == false 이면 마지막 개행 이후의 미완성 행은 남겨두고,
+	// 소비한 바이트 수(= 다음 호출에서 이어 붙일 시작 위치)를 돌려준다.
+	// last == true 이면 끝까지 하나의 행으로 마무리하고 n 을 돌려준다.
+	template <class OnRow>
+	size_t tokenize(const char* data, size_t n, bool last, OnRow&& onRow) {
+		return run(data, nullptr, n, last, onRow);
+	}
+
+	// tokenize 와 같지만 따옴표 필드를 data 안에서 제자리로 푼다(풀린 값은 항상 원문보다 짧다).
+	// 필드 view 를 모아 두었다가 나중에 써도 되고, 셀마다 복사할 필요가 없다.
+	template <class OnRow>
+	size_t tokenizeInPlace(char* data, size_t n, bool last, OnRow&& onRow) {
+		return run(data, data, n, last, onRow);
+	}
+
+private:
+	struct Span { size_t begin; size_t end; bool quoted; };
+
+	// inPlace 가 있으면(= data) 따옴표 필드를 그 자리에 풀고, 없으면 scratch 에 푼다.
+	template <class OnRow>
+	size_t run(const char* data, char* inPlace, size_t n, bool last, OnRow& onRow) {
+		spans.clear();
+		size_t rowStart = 0;
+		size_t fieldStart = 0;
+		bool fieldQuoted = false;
+		uint64_t inQuoteCarry = 0;
+
+		alignas(64) char pad[64];
+		for (size_t base = 0; base < n; base += 64) {
+			const char* blk = data + base;
+			size_t avail = n - base;
+			if (avail < 64) {
+				std::memset(pad, 0, sizeof(pad));
+				std::memcpy(pad, blk, avail);
+				blk = pad;
+			}
+			CsvBlockMasks m = csvScanBlock(blk);
+			uint64_t inQuote = csvPrefixXor(m.quote) ^ inQuoteCarry;
+			inQuoteCarry = 0ull - (inQuote >> 63);
+
+			uint64_t seps = (m.comma | m.newline) & ~inQuote;
+			unsigned lo = 0;
+			while (seps) {
+				unsigned b = csvCtz64(seps);
+				seps &= seps - 1;
+				size_t pos = base + b;
+				bool quoted = fieldQuoted || (m.quote & csvRangeMask(lo, b)) != 0;
+				bool isNewline = (m.newline >> b) & 1;
+				size_t end = pos;
+				if (isNewline && end > fieldStart && data[end - 1] == '\r') --end;
+				spans.push_back({ fieldStart, end, quoted });
+				if (isNewline) {
+					emitRow(data, inPlace, onRow);
+					rowStart = pos + 1;
+				}
+				fieldStart = pos + 1;
+				fieldQuoted = false;
+				lo = b + 1;
+			}
+			if (m.quote & csvRangeMask(lo, 64)) fieldQuoted = true;
+		}
+
+		if (!last) {
+			spans.clear();
+			return rowStart;
+		}
+		if (rowStart < n) {
+			size_t end = n;
+			if (end > fieldStart && data[end - 1] == '\r') --end;
+			spans.push_back({ fieldStart, end, fieldQuoted });
+			emitRow(data, inPlace, onRow);
+		}
+		spans.clear();
+		return n;
+	}
+
+	// 행의 필드는 모두 지금 스캔 위치보다 앞에 있으므로 제자리로 풀어도 이후 스캔에 영향이 없다.
+	template <class OnRow>
+	void emitRow(const char* data, char* inPlace, OnRow& onRow) {
+		fields.clear();
+		if (inPlace) {
+			for (const Span& sp : spans) {
+				size_t len = sp.end - sp.begin;
+				if (sp.quoted) len = csvUnquote(data + sp.begin, len, inPlace + sp.begin);
+				fields.emplace_back(data + sp.begin, len);
+			}
+			spans.clear();
+			onRow(static_cast<const std::vector<std::string_view>&>(fields));
+			return;
+		}
+		size_t need = 0;
+		for (const Span& sp : spans)
+			if (sp.quoted) need += sp.end - sp.begin;
+		if (scratch.size() < need) scratch.resize(need);
+
+		char* w = scratch.empty() ? nullptr : &scratch[0];
+		for (const Span& sp : spans) {
+			if (!sp.quoted) {
+				fields.emplace_back(data + sp.begin, sp.end - sp.begin);
+				continue;
+			}
+			size_t len = csvUnquote(data + sp.begin, sp.end - sp.begin, w);
+			fields.emplace_back(w, len);
+			w += len;
+		}
+		spans.clear();
+		onRow(static_cast<const std::vector<std::string_view>&>(fields));
+	}
+
+	std::vector<Span> spans;
+	std::vector<std::string_view> fields;
+	std::string scratch;
+};
+
+// -------------------- 병렬 분할용 행 경계 --------------------
+// data[from, to) 를 64바이트 블록으로 훑어, 구간 시작이 따옴표 밖/안인 두 경우 각각의
+// 첫 행 끝('\n' 위치)과 구간 전체의 따옴표 개수 홀짝을 한 번에 구한다.
+// 구간 시작의 실제 따옴표 상태는 앞 구간들의 홀짝을 이어야 알 수 있으므로
+// 두 경우를 모두 미리 계산해 두고(추측), 나중에 맞는 쪽을 고른다.
+struct CsvSplitScan {
+	size_t rowEnd[2] = { SIZE_MAX, SIZE_MAX }; // [시작 상태] → 첫 따옴표 밖 '\n' 위치 (없으면 SIZE_MAX)
+	unsigned quoteParity = 0;
+};
+
+static inline CsvSplitScan csvScanSplit(const char* data, size_t from, size_t to) {
+	CsvSplitScan r;
+	uint64_t inQuoteCarry = 0;
+	alignas(64) char pad[64];
+	for (size_t base = from; base < to; base += 64) {
+		const char* blk = data + base;
+		size_t avail = to - base;
+		if (avail < 64) {
+			std::memset(pad, 0, sizeof(pad));
+			std::memcpy(pad, blk, avail);
+			blk = pad;
+		}
+		CsvBlockMasks m = csvScanBlock(blk);
+		uint64_t inQuote = csvPrefixXor(m.quote) ^ inQuoteCarry; // 시작이 따옴표 밖이라고 볼 때
+		inQuoteCarry = 0ull - (inQuote >> 63);
+		if (r.rowEnd[0] == SIZE_MAX && (m.newline & ~inQuote))
+			r.rowEnd[0] = base + csvCtz64(m.newline & ~inQuote);
+		if (r.rowEnd[1] == SIZE_MAX && (m.newline & inQuote))
+			r.rowEnd[1] = base + csvCtz64(m.newline & inQuote);
+	}
+	r.quoteParity = (unsigned)(inQuoteCarry & 1);
+	return r;
+}
+
+// data[0, n) 을 parts 개 정도의 행 단위 구간으로 나눈다.
+// 돌려주는 오프셋은 0 으로 시작해 n 으로 끝나는 오름차순이고, 중간 값은 모두 행 시작(따옴표 밖 '\n' 다음).
+// 한 구간 안에 행 끝이 없으면(아주 긴 따옴표 필드) 그 경계는 빠진다.
+// scan(k, from, to) 는 구간 k 의 csvScanSplit 결과를 채운다 → 호출자가 스레드로 나눠 돌릴 수 있다.
+template <class ParallelFor>
+std::vector<size_t> csvSplitRows(const char* data, size_t n, unsigned parts, ParallelFor&& parallelFor) {
+	if (parts < 2 || n < parts) return { 0, n };
+	std::vector<CsvSplitScan> scans(parts);
+	size_t step = n / parts;
+	parallelFor(parts, [&](unsigned k) {
+		size_t from = k * step;
+		size_t to = (k + 1 == parts) ? n : from + step;
+		scans[k] = csvScanSplit(data, from, to);
+		});
+	std::vector<size_t> starts{ 0 };
+	unsigned state = 0; // 데이터 시작은 따옴표 밖
+	for (unsigned k = 0; k < parts; ++k) {
+		size_t end = scans[k].rowEnd[state];
+		// 구간 k 안의 첫 행 끝 다음이 k 번째 조각의 시작 (조각 0 은 데이터 시작부터)
+		if (k > 0 && end != SIZE_MAX && end + 1 > starts.back() && end + 1 < n) starts.push_back(end + 1);
+		state ^= scans[k].quoteParity;
+	}
+	starts.push_back(n);
+	return starts;
+}
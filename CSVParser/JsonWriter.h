@@ -0,0 +1,191 @@
+// JsonWriter.h : 시트 → JSON 배열 스트리밍 직렬화
+// 컬럼 정렬 순서와 키 리터럴("Key":)은 시트당 한 번만 만들고,
+// 행은 호출자가 넘긴 출력 버퍼에 바로 이어 쓴다(행/객체 단위 임시 문자열 없음).
+#pragma once
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CsvTokenizer.h" // SIMD 감지(CSV_SIMD_*), csvCtz64
+#include "ColumnTypes.h"
+
+// -------------------- JSON 문자열 escape --------------------
+// 바이트별 escape 문자(0 이면 그대로 복사, 'u' 면 \u00XX)
+struct JsonEscapeTable {
+	char t[256];
+	constexpr JsonEscapeTable() : t() {
+		for (int c = 0; c < 0x20; ++c) t[c] = 'u';
+		t[(unsigned char)'"'] = '"';
+		t[(unsigned char)'\\'] = '\\';
+		t[(unsigned char)'\b'] = 'b';
+		t[(unsigned char)'\f'] = 'f';
+		t[(unsigned char)'\n'] = 'n';
+		t[(unsigned char)'\r'] = 'r';
+		t[(unsigned char)'\t'] = 't';
+	}
+};
+static constexpr JsonEscapeTable kJsonEscape{};
+
+// s[i, n) 에서 escape 가 필요한 첫 위치(없으면 n). SIMD 로 16/32바이트씩 건너뛴다.
+static inline size_t jsonFindEscape(const char* s, size_t i, size_t n) {
+#if defined(__AVX2__)
+	const __m256i q = _mm256_set1_epi8('"');
+	const __m256i bs = _mm256_set1_epi8('\\');
+	const __m256i ctl = _mm256_set1_epi8(0x1F);
+	for (; i + 32 <= n; i += 32) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+		__m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, q), _mm256_cmpeq_epi8(v, bs)),
+			_mm256_cmpeq_epi8(_mm256_min_epu8(v, ctl), v)); // v <= 0x1F (부호 없는 비교)
+		unsigned mask = (unsigned)_mm256_movemask_epi8(m);
+		if (mask) return i + csvCtz64(mask);
+	}
+#elif defined(CSV_SIMD_SSE2)
+	const __m128i q = _mm_set1_epi8('"');
+	const __m128i bs = _mm_set1_epi8('\\');
+	const __m128i ctl = _mm_set1_epi8(0x1F);
+	for (; i + 16 <= n; i += 16) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+		__m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, q), _mm_cmpeq_epi8(v, bs)),
+			_mm_cmpeq_epi8(_mm_min_epu8(v, ctl), v));
+		unsigned mask = (unsigned)_mm_movemask_epi8(m);
+		if (mask) return i + csvCtz64(mask);
+	}
+#endif
+	while (i < n && !kJsonEscape.t[(unsigned char)s[i]]) ++i;
+	return i;
+}
+
+// out 뒤에 s 를 escape 해서 붙인다. escape 할 게 없는 구간은 통째로 복사.
+static inline void appendJsonEscaped(std::string& out, std::string_view s) {
+	static const char hex[] = "0123456789abcdef";
+	const char* p = s.data();
+	size_t n = s.size(), i = 0;
+	while (i < n) {
+		size_t j = jsonFindEscape(p, i, n);
+		out.append(p + i, j - i);
+		if (j == n) break;
+		unsigned char c = (unsigned char)p[j];
+		char e = kJsonEscape.t[c];
+		if (e == 'u') {
+			char u[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF] };
+			out.append(u, 6);
+		}
+		else {
+			char u[2] = { '\\', e };
+			out.append(u, 2);
+		}
+		i = j + 1;
+	}
+}
+
+// -------------------- 테이블 writer --------------------
+// 출력 형식: [{"A":"..","B":1},{...}]  (키는 컬럼명 사전순)
+// lines 면 NDJSON: 배열 없이 한 줄에 객체 하나({"A":"..","B":1}\n). 문자열 안의 개행은 \n 으로
+// escape 되므로 읽는 쪽은 '\n' 에서 바로 나눠 줄 단위로(병렬로도) 파싱할 수 있다.
+// types 가 비어 있으면 모든 값을 문자열로 쓴다. 타입과 맞지 않는 값은 runtime_error.
+class JsonTableWriter {
+public:
+	// 버퍼가 이만큼 차면 호출자가 flush 로 스트림에 내보낸다(Main.cpp 의 writeSheet 은 그 시간을 쓰기 단계로 집계).
+	static const size_t FlushBytes = 256 * 1024;
+
+	explicit JsonTableWriter(const std::vector<std::string>& columns,
+		const std::vector<ColumnSpec>& types = {}, bool lines = false) : columns(columns), types(types), lines(lines) {
+		this->types.resize(columns.size());
+		for (auto& t : this->types)
+			if (t.type == ColumnType::Auto) t.type = ColumnType::String;
+		// 같은 이름이 여러 번 나오면 마지막 컬럼이 이긴다(기존 map 대입과 동일)
+		for (size_t c = 0; c < columns.size(); ++c) {
+			auto it = std::find_if(order.begin(), order.end(),
+				[&](size_t o) { return columns[o] == columns[c]; });
+			if (it != order.end()) *it = c;
+			else order.push_back(c);
+		}
+		std::sort(order.begin(), order.end(),
+			[&](size_t a, size_t b) { return columns[a] < columns[b]; });
+		keys.reserve(order.size());
+		for (size_t k = 0; k < order.size(); ++k) {
+			std::string key = k ? "," : "";
+			key += '"';
+			appendJsonEscaped(key, columns[order[k]]);
+			key += "\":";
+			keys.push_back(std::move(key));
+		}
+	}
+
+	void begin(std::string& out) { if (!lines) out += '['; rowCount = 0; }
+	// 배열이면 ']'. 끝 개행은 호출자가 붙인다(NDJSON 은 행마다 이미 붙어 있다).
+	void end(std::string& out) { if (!lines) out += ']'; }
+
+	// values[c] 는 columns[c] 의 값 (std::string / std::string_view)
+	template <class Row>
+	void writeRow(std::string& out, const Row& values) {
+		if (rowCount++ && !lines) out += ',';
+		out += '{';
+		for (size_t k = 0; k < order.size(); ++k) {
+			size_t c = order[k];
+			out += keys[k];
+			writeValue(out, c, values[c]);
+		}
+		out += '}';
+		if (lines) out += '\n';
+	}
+
+	size_t rows() const { return rowCount; }
+
+	static void flush(std::ostream& os, std::string& buf) {
+		os.write(buf.data(), (std::streamsize)buf.size());
+		buf.clear();
+	}
+
+private:
+	void writeValue(std::string& out, size_t c, std::string_view v) {
+		const ColumnSpec& t = types[c];
+		if (t.type == ColumnType::String) {
+			out += '"';
+			appendJsonEscaped(out, v);
+			out += '"';
+			return;
+		}
+		if (v.empty()) { out += "null"; return; }
+		bool b = false;
+		switch (t.type) {
+		case ColumnType::Int:
+			if (!isIntLiteral(v)) typeError(c, v);
+			out += v;
+			break;
+		case ColumnType::Float:
+			if (!isFloatLiteral(v)) typeError(c, v);
+			out += v;
+			break;
+		case ColumnType::Bool:
+			if (!parseBoolLiteral(v, b)) typeError(c, v);
+			out += b ? "true" : "false";
+			break;
+		case ColumnType::Enum: {
+			bool ok = false;
+			for (const auto& e : t.enumValues) if (v == e) { ok = true; break; }
+			if (!ok) typeError(c, v);
+			out += '"';
+			appendJsonEscaped(out, v);
+			out += '"';
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	[[noreturn]] void typeError(size_t c, std::string_view v) const {
+		throw std::runtime_error("column '" + columns[c] + "': \"" + std::string(v)
+			+ "\" is not " + columnTypeName(types[c].type));
+	}
+
+	std::vector<std::string> columns;
+	std::vector<ColumnSpec> types;
+	std::vector<size_t> order;     // 출력 순서 → 컬럼 인덱스
+	std::vector<std::string> keys; // 출력 순서별 `,"Key":` 리터럴
+	bool lines = false;            // NDJSON
+	size_t rowCount = 0;
+};
@@ -1,4 +1,4 @@
-// mycsv2json.cpp : C++17, 단일 파일, 외부 라이브러리 없이 빌드 가능
+﻿// mycsv2json.cpp : C++17, 외부 라이브러리 없이 빌드 가능 (같은 폴더의 헤더만 사용)
 // 빌드 예: g++ -std=c++17 -O2 -o mycsv2json mycsv2json.cpp
 //        cl /std:c++17 /O2 mycsv2json.cpp
 #include <iostream>
@@ -8,20 +8,62 @@
 #include <string>
 #include <unordered_map>
 #include <algorithm>
-#include <iomanip>
 #include <filesystem>
+#include <string_view>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <new>
 
-#ifdef _WIN32
-#include <windows.h>
-#endif
+#include "CsvTokenizer.h"
+#include "TextEncoding.h"
+#include "JsonWriter.h"
+#include "ColumnTypes.h"
+#include "BinTableWriter.h"
+#include "Manifest.h"
+#include "ConvertStats.h"
+#include "../TextRPG/TableSchemas.h"
 
 using namespace std;
 namespace fs = std::filesystem;
 
+// -------------------- 할당 카운터 (--stats) --------------------
+// --stats 의 allocs 를 위해 전역 operator new 를 바꾼다.
+// 스레드별 호출 수만 올린다(락/분기 없음). 할당 자체는 기본과 같은 malloc/free.
+// new[] / nothrow new 의 기본 구현은 이 함수를 부르므로 따로 바꾸지 않는다.
+void* operator new(std::size_t n) {
+	++tlsAllocCount;
+	if (n == 0) n = 1;
+	for (;;) {
+		if (void* p = std::malloc(n)) return p;
+		std::new_handler h = std::get_new_handler();
+		if (!h) throw std::bad_alloc();
+		h();
+	}
+}
+// GCC 는 인라인된 delete 의 free 를 new 와 짝이 안 맞는다고 오탐하므로 경고만 끈다.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
 // -------------------- 유틸: 트림 --------------------
-static inline string ltrim(string s) { s.erase(s.begin(), find_if(s.begin(), s.end(), [](unsigned char c) {return !isspace(c); })); return s; }
-static inline string rtrim(string s) { s.erase(find_if(s.rbegin(), s.rend(), [](unsigned char c) {return !isspace(c); }).base(), s.end()); return s; }
-static inline string trim(string s) { return rtrim(ltrim(std::move(s))); }
+// view 의 앞뒤 공백만 잘라낸다(복사 없음)
+static inline string_view trim(string_view s) {
+	size_t b = 0, e = s.size();
+	while (b < e && isspace((unsigned char)s[b])) ++b;
+	while (e > b && isspace((unsigned char)s[e - 1])) --e;
+	return s.substr(b, e - b);
+}
 
 // UTF-8 BOM 제거
 static inline void strip_utf8_bom(std::string& s) {
@@ -33,50 +75,6 @@ static inline void strip_utf8_bom(std::string& s) {
 	}
 }
 
-// 간단한 UTF-8 유효성 검사 (BOM 유무와 무관)
-static bool looks_like_utf8(const std::string& s) {
-	const unsigned char* p = (const unsigned char*)s.data();
-	size_t i = 0, n = s.size();
-	while (i < n) {
-		unsigned char c = p[i];
-		if (c < 0x80) { i++; continue; }               // ASCII
-		else if ((c >> 5) == 0x6) {                         // 110xxxxx
-			if (i + 1 >= n) return false;
-			if ((p[i + 1] >> 6) != 0x2) return false;
-			i += 2;
-		}
-		else if ((c >> 4) == 0xE) {                        // 1110xxxx
-			if (i + 2 >= n) return false;
-			if ((p[i + 1] >> 6) != 0x2 || (p[i + 2] >> 6) != 0x2) return false;
-			i += 3;
-		}
-		else if ((c >> 3) == 0x1E) {                       // 11110xxx
-			if (i + 3 >= n) return false;
-			if ((p[i + 1] >> 6) != 0x2 || (p[i + 2] >> 6) != 0x2 || (p[i + 3] >> 6) != 0x2) return false;
-			i += 4;
-		}
-		else {
-			return false;
-		}
-	}
-	return true;
-}
-
-#ifdef _WIN32
-// 임의 코드페이지 → UTF-8
-static std::string cp_to_utf8(const std::string& s, unsigned codepage) {
-	if (s.empty()) return {};
-	int wlen = MultiByteToWideChar(codepage, 0, s.data(), (int)s.size(), nullptr, 0);
-	if (wlen <= 0) return {};
-	std::wstring w(wlen, L'\0');
-	MultiByteToWideChar(codepage, 0, s.data(), (int)s.size(), &w[0], wlen);
-	int u8len = WideCharToMultiByte(CP_UTF8, 0, w.data(), (int)w.size(), nullptr, 0, nullptr, nullptr);
-	std::string u8(u8len, '\0');
-	WideCharToMultiByte(CP_UTF8, 0, w.data(), (int)w.size(), &u8[0], u8len, nullptr, nullptr);
-	return u8;
-}
-#endif
-
 // -------------------- A1 표기 -> (row,col) 0기반 --------------------
 struct CellPos { size_t row; size_t col; };
 bool a1ToRowCol(const string& a1, CellPos& out) {
@@ -101,102 +99,45 @@ bool a1ToRowCol(const string& a1, CellPos& out) {
 	return true;
 }
 
-// -------------------- CSV 파서 (따옴표/콤마/개행 처리) --------------------
-vector<string> parseCsvLine(const string& line) {
-	vector<string> out;
-	string cur;
-	bool inQuotes = false;
-	for (size_t i = 0; i < line.size(); ++i) {
-		char c = line[i];
-		if (inQuotes) {
-			if (c == '"') {
-				if (i + 1 < line.size() && line[i + 1] == '"') { // "" -> "
-					cur.push_back('"'); ++i;
-				}
-				else {
-					inQuotes = false;
-				}
-			}
-			else {
-				cur.push_back(c);
-			}
-		}
-		else {
-			if (c == '"') { inQuotes = true; }
-			else if (c == ',') { out.push_back(cur); cur.clear(); }
-			else { cur.push_back(c); }
-		}
-	}
-	out.push_back(cur);
-	return out;
-}
-
-// -------------------- 간단 JSON 직렬화 (string escape 포함) --------------------
-string jsonEscape(const string& s) {
-	ostringstream oss;
-	for (unsigned char c : s) {
-		switch (c) {
-		case '\"': oss << "\\\""; break;
-		case '\\': oss << "\\\\"; break;
-		case '\b': oss << "\\b"; break;
-		case '\f': oss << "\\f"; break;
-		case '\n': oss << "\\n"; break;
-		case '\r': oss << "\\r"; break;
-		case '\t': oss << "\\t"; break;
-		default:
-			if (c < 0x20) {
-				oss << "\\u" << hex << setw(4) << setfill('0') << (int)c;
-			}
-			else {
-				oss << c;
-			}
-		}
-	}
-	return oss.str();
-}
-
-string jsonString(const string& s) { return string("\"") + jsonEscape(s) + "\""; }
-
-string jsonObject(const vector<pair<string, string>>& kvs) {
-	// kvs: key is already string literal (no quotes), value should be valid JSON literal
-	// value는 이미 jsonString() 등으로 적절히 만들어 전달
-	string out = "{";
-	for (size_t i = 0; i < kvs.size(); ++i) {
-		if (i) out += ',';
-		out += jsonString(kvs[i].first);
-		out += ':';
-		out += kvs[i].second;
-	}
-	out += "}";
-	return out;
-}
-
-string jsonArray(const vector<string>& elems) {
-	string out = "[";
-	for (size_t i = 0; i < elems.size(); ++i) {
-		if (i) out += ',';
-		out += elems[i];
-	}
-	out += "]";
-	return out;
-}
-
 // -------------------- 설정 구조 --------------------
 struct SheetConf {
 	string startCell = "A1";
 	vector<string> columns; // 가로 방향 필드명
+	vector<ColumnSpec> types; // columns 와 같은 순서. 없거나 "auto" 면 추론(inferTypes)
 };
 
 struct Config {
 	// 시트명(CSV 파일명(확장자 제외)) -> 설정
 	unordered_map<string, SheetConf> sheets;
 	bool stopOnEmptyFirstColumn = true;
+	// 타입이 auto 인 컬럼을 값으로 추론(false 면 예전처럼 모두 문자열)
+	bool inferTypes = true;
 
-	// "auto" | "utf8" | "cp949"
+	// "auto" | "utf8" | "cp949" ("euckr" 도 cp949 로 읽음)
 	std::string inputEncoding = "auto";
 	bool outputUtf8Bom = true;
+
+	// 이 크기 이상인 CSV 는 스트리밍 경로로 변환 (--stream 이면 항상)
+	uintmax_t streamThresholdBytes = 64ull << 20;
 };
 
+// TextRPG 테이블 스키마(TableSchemas.h)로 기본 시트 설정을 만든다.
+// 컬럼 순서/이름/타입이 게임 쪽 로더와 같은 정의에서 나오므로 따로 맞출 필요가 없다.
+template <class Schema>
+static pair<const string, SheetConf> schemaSheetConf() {
+	constexpr auto names = SchemaColumnNames<Schema>();
+	constexpr auto types = SchemaColumnTypes<Schema>();
+	SheetConf sc;
+	sc.startCell = Schema::StartCell;
+	for (size_t c = 0; c < names.size(); ++c) {
+		sc.columns.emplace_back(names[c]);
+		ColumnSpec spec;
+		spec.type = (types[c] == SchemaType::Int) ? ColumnType::Int : ColumnType::String; // Enum 은 문자열로 저장
+		sc.types.push_back(spec);
+	}
+	return { Schema::Sheet, sc };
+}
+
 // config.json 간단 파서(아주 제한적; 따옴표/콤마/콜론/중괄호만, 공백허용)
 bool loadConfigJson(const fs::path& path, Config& cfg) {
 	if (!fs::exists(path)) return false;
@@ -219,20 +160,22 @@ bool loadConfigJson(const fs::path& path, Config& cfg) {
 		return pos;
 		};
 
-	// stopOnEmptyFirstColumn
-	{
-		auto ps = findStr("stopOnEmptyFirstColumn");
+	// stopOnEmptyFirstColumn, inferTypes
+	auto readBool = [&](const string& key, bool& dst) {
+		auto ps = findStr(key);
 		if (!ps.empty()) {
 			size_t p = all.find(':', ps[0]);
 			if (p != string::npos) {
 				size_t q = all.find_first_not_of(" \t\r\n", p + 1);
 				if (q != string::npos) {
-					if (all.compare(q, 4, "true") == 0) cfg.stopOnEmptyFirstColumn = true;
-					else if (all.compare(q, 5, "false") == 0) cfg.stopOnEmptyFirstColumn = false;
+					if (all.compare(q, 4, "true") == 0) dst = true;
+					else if (all.compare(q, 5, "false") == 0) dst = false;
 				}
 			}
 		}
-	}
+		};
+	readBool("stopOnEmptyFirstColumn", cfg.stopOnEmptyFirstColumn);
+	readBool("inferTypes", cfg.inferTypes);
 
 	// sheets
 	// 아주 러프하게 "sheets" 오브젝트 블록 추출
@@ -284,9 +227,9 @@ bool loadConfigJson(const fs::path& path, Config& cfg) {
 				if (q1 != string::npos && q2 != string::npos) sc.startCell = sb.substr(q1 + 1, q2 - q1 - 1);
 			}
 		}
-		// columns
-		{
-			size_t p = sb.find("\"columns\"");
+		// columns / types : 문자열 배열
+		auto readStrArray = [&](const string& key, vector<string>& dst) {
+			size_t p = sb.find("\"" + key + "\"");
 			if (p != string::npos) {
 				size_t c = sb.find(':', p);
 				size_t b1 = sb.find('[', c);
@@ -299,11 +242,23 @@ bool loadConfigJson(const fs::path& path, Config& cfg) {
 						if (s1 == string::npos) break;
 						size_t s2 = arr.find('"', s1 + 1);
 						if (s2 == string::npos) break;
-						sc.columns.push_back(arr.substr(s1 + 1, s2 - s1 - 1));
+						dst.push_back(arr.substr(s1 + 1, s2 - s1 - 1));
 						u = s2 + 1;
 					}
 				}
 			}
+			};
+		readStrArray("columns", sc.columns);
+		{
+			// 예: "types": ["int", "string", "enum:Consume|None", "int", "auto"]
+			vector<string> typeNames;
+			readStrArray("types", typeNames);
+			for (const auto& tn : typeNames) {
+				ColumnSpec spec;
+				if (!parseColumnSpec(tn, spec))
+					cerr << "[Warn] " << sheetName << ": unknown column type \"" << tn << "\" (auto)\n";
+				sc.types.push_back(spec);
+			}
 		}
 
 		cfg.sheets[sheetName] = sc;
@@ -314,11 +269,159 @@ bool loadConfigJson(const fs::path& path, Config& cfg) {
 }
 
 // -------------------- CSV → JSON 변환 --------------------
+// 입력을 읽으면서 알게 된 정보(로그용)
+struct CsvReadInfo {
+	std::string encoding;              // 실제로 적용한 인코딩
+	size_t invalidUtf8At = kUtf8Valid; // 파일 기준 첫 잘못된 UTF-8 시퀀스 오프셋
+	bool retryAsCp949 = false;         // 스트리밍 auto: 첫 청크 뒤에서 UTF-8 이 아닌 바이트를 만나 중단함
+};
+
+// 입력 인코딩 결정. sample 은 파일 앞부분(또는 전체).
+// auto/utf8 이면 UTF-8 검증을 하고, 잘못된 곳이 있으면 invalidAt 에 sample 기준 오프셋을 남긴다.
+static std::string resolveInputEncoding(const std::string& sample, const std::string& inputEnc, size_t& invalidAt) {
+	invalidAt = kUtf8Valid;
+	if (inputEnc == "euckr" || inputEnc == "euc-kr") return "cp949"; // CP949 가 EUC-KR 의 상위 집합
+	if (inputEnc != "auto" && inputEnc != "utf8") return inputEnc;
+	invalidAt = utf8FirstInvalid(sample);
+	if (inputEnc != "auto") return inputEnc;
+	// 순서: UTF-8로 보이면 그대로 → 아니면 CP949(엑셀 한글 CSV 기본)로 변환
+	if (!sample.empty() && invalidAt == kUtf8Valid) return "utf8";
+	return "cp949";
+}
+
+// mode 에 맞춰 text 를 UTF-8 로 바꾼다(이미 UTF-8 이면 그대로).
+static void convertToUtf8(std::string& text, const std::string& mode) {
+	if (mode == "cp949") {
+		text = cp949ToUtf8(text); // 내장 표(TextEncoding.h) → 모든 플랫폼 같은 결과
+	}
+}
+
+// -------------------- 행 목록 (view) --------------------
+// 한 행의 필드들. values[c] 로 읽는 writer/추론기에 그대로 넘긴다.
+struct CsvRowView {
+	const string_view* fields;
+	size_t count;
+	size_t size() const { return count; }
+	const string_view& operator[](size_t i) const { return fields[i]; }
+};
+
+// 모든 행의 필드를 한 배열에 이어 둔다 → 행/셀마다 할당이 없다.
+// 필드는 다른 버퍼(Table::text 등)를 가리키므로 그 버퍼보다 오래 쓰면 안 된다.
+struct CsvRows {
+	vector<string_view> cells;
+	vector<size_t> rowEnds; // 행 r 의 필드 = cells[r ? rowEnds[r - 1] : 0, rowEnds[r])
+
+	size_t size() const { return rowEnds.size(); }
+	CsvRowView operator[](size_t r) const {
+		size_t b = r ? rowEnds[r - 1] : 0;
+		return { cells.data() + b, rowEnds[r] - b };
+	}
+	template <class Row>
+	void push(const Row& fields) {
+		for (size_t c = 0; c < fields.size(); ++c) cells.push_back(fields[c]);
+		rowEnds.push_back(cells.size());
+	}
+	void append(const CsvRows& o) {
+		size_t base = cells.size();
+		cells.insert(cells.end(), o.cells.begin(), o.cells.end());
+		for (size_t e : o.rowEnds) rowEnds.push_back(base + e);
+	}
+	void clear() { cells.clear(); rowEnds.clear(); }
+};
+
+// 통째로 읽은 시트. rows 의 필드는 text 를 가리킨다(따옴표 필드는 text 안에서 제자리로 풀림).
 struct Table {
-	vector<vector<string>> cells; // [row][col]
+	std::string text; // UTF-8
+	CsvRows rows;
 };
 
-bool loadCsv(const fs::path& file, Table& t, const std::string& inputEnc /*= "auto"*/) {
+// -------------------- 병렬 파싱 (큰 시트 하나를 여러 스레드로) --------------------
+// 조각이 이보다 작아지면 나누지 않는다(스레드 비용이 더 크다)
+static const size_t kParallelMinPartBytes = 1 << 20;
+static const size_t kParallelMinPartRows = 16384;
+
+// fn(0) ~ fn(count-1) 을 각자 스레드에서(0 은 호출 스레드) 돌리고 모두 끝날 때까지 기다린다.
+// 워커 스레드의 할당 횟수는 호출 스레드 카운터로 옮겨 --stats 에 그대로 잡히게 한다.
+// 워커에서 난 예외는 join 뒤에 다시 던진다. cancel 이 있으면 예외가 나는 즉시 켜서
+// 다른 조각이 보고 일찍 끝낼 수 있게 한다(어차피 결과는 버려진다).
+template <class Fn>
+static void parallelFor(unsigned count, Fn&& fn, std::atomic<bool>* cancel = nullptr) {
+	if (count <= 1) {
+		if (count) fn(0u);
+		return;
+	}
+	vector<std::exception_ptr> errors(count);
+	vector<uint64_t> allocs(count, 0);
+	auto run = [&](unsigned k) {
+		uint64_t before = tlsAllocCount;
+		try { fn(k); }
+		catch (...) {
+			errors[k] = std::current_exception();
+			if (cancel) cancel->store(true, std::memory_order_relaxed);
+		}
+		allocs[k] = tlsAllocCount - before;
+		};
+	vector<std::thread> pool;
+	for (unsigned k = 1; k < count; ++k) pool.emplace_back(run, k);
+	run(0);
+	for (auto& th : pool) th.join();
+	for (unsigned k = 1; k < count; ++k) tlsAllocCount += allocs[k];
+	for (auto& e : errors) if (e) std::rethrow_exception(e);
+}
+
+// bytes 를 jobs 개 이하, 조각당 kParallelMinPartBytes 이상으로 나눌 때의 조각 수
+static unsigned parseParts(size_t bytes, unsigned jobs) {
+	return (unsigned)std::max<size_t>(1, std::min<size_t>(jobs, bytes / kParallelMinPartBytes));
+}
+
+// data[0, n) 을 행 경계(csvSplitRows)로 나눠 조각마다 제자리 토큰화하고, 행 순서대로 rows 뒤에 붙인다.
+// last == false 면 마지막 미완성 행은 남기고 소비한 바이트 수를 돌려준다(CsvTokenizer::tokenize 와 같음).
+static size_t tokenizeParallel(char* data, size_t n, bool last, unsigned jobs,
+	CsvRows& rows, size_t& cells) {
+	vector<size_t> starts = csvSplitRows(data, n, parseParts(n, jobs),
+		[](unsigned count, auto&& fn) { parallelFor(count, fn); });
+	unsigned parts = (unsigned)starts.size() - 1;
+	vector<CsvRows> partRows(parts);
+	vector<size_t> partCells(parts, 0);
+	size_t used = n;
+	std::atomic<bool> cancel{ false };
+	struct Cancelled {};
+	parallelFor(parts, [&](unsigned k) {
+		// 마지막이 아닌 조각은 '\n' 바로 뒤에서 끝나므로 last=true 로 닫아도 남는 행이 없다
+		bool lastPart = (k + 1 == parts);
+		CsvTokenizer tok;
+		try {
+			size_t u = tok.tokenizeInPlace(data + starts[k], starts[k + 1] - starts[k], lastPart ? last : true,
+				[&](const vector<string_view>& fields) {
+					// 다른 조각이 실패했으면 토크나이저를 빠져나간다(행 콜백 말고는 멈출 곳이 없다)
+					if (cancel.load(std::memory_order_relaxed)) throw Cancelled();
+					partRows[k].push(fields);
+					partCells[k] += fields.size();
+				});
+			if (lastPart) used = starts[k] + u;
+		}
+		catch (const Cancelled&) {}
+		}, &cancel);
+	if (parts == 1) {
+		rows.append(partRows[0]);
+		cells += partCells[0];
+		return used;
+	}
+	size_t total = rows.cells.size(), totalRows = rows.size();
+	for (unsigned k = 0; k < parts; ++k) { total += partRows[k].cells.size(); totalRows += partRows[k].size(); }
+	rows.cells.reserve(total);
+	rows.rowEnds.reserve(totalRows);
+	for (unsigned k = 0; k < parts; ++k) {
+		cells += partCells[k];
+		rows.append(partRows[k]);
+	}
+	return used;
+}
+
+// jobs > 1 이고 입력이 충분히 크면 토큰화를 여러 스레드로 나눈다(결과는 같다).
+bool loadCsv(const fs::path& file, Table& t, const std::string& inputEnc /*= "auto"*/, CsvReadInfo* info = nullptr,
+	SheetStats* stats = nullptr, unsigned jobs = 1) {
+	StatScope readScope(stats, StatPhase::Read);
 	std::ifstream in(file, std::ios::binary);
 	if (!in) return false;
 
@@ -327,94 +430,597 @@ bool loadCsv(const fs::path& file, Table& t, const std::string& inputEnc /*= "au
 	in.close();
 
 	// \r\n → \n 정규화
+	size_t bomLen = bin.size();
 	if (!bin.empty()) {
 		// BOM 제거(있으면)
 		strip_utf8_bom(bin);
 	}
-	std::string text = bin;
+	bomLen -= bin.size();
+	std::string& text = t.text;
+	text = std::move(bin);
+	statAdd(stats, StatPhase::Read, bomLen + text.size());
 
 	// 인코딩 결정
-	std::string mode = inputEnc;
-	if (mode == "auto") {
-		// 순서: UTF-8로 보이면 그대로 → 아니면 Windows에서 CP949로 변환 시도
-		if (!text.empty() && looks_like_utf8(text)) {
-			mode = "utf8";
-		}
-		else {
-#ifdef _WIN32
-			mode = "cp949";
-#else
-			// 비윈도우는 CP949 변환 루틴이 없으므로, 그냥 UTF-8로 가정
-			mode = "utf8";
-#endif
-		}
-	}
-
-#ifdef _WIN32
-	if (mode == "cp949") {
-		text = cp_to_utf8(text, 949); // EUC-KR/CP949
+	StatScope decodeScope(stats, StatPhase::Decode);
+	statAdd(stats, StatPhase::Decode, text.size());
+	size_t invalidAt;
+	std::string mode = resolveInputEncoding(text, inputEnc, invalidAt);
+	if (info) {
+		info->encoding = mode;
+		info->invalidUtf8At = (invalidAt == kUtf8Valid) ? kUtf8Valid : invalidAt + bomLen;
 	}
-#endif
+	convertToUtf8(text, mode);
 	// 여기까지 오면 text는 UTF-8
 
-	// 라인 분리
-	std::istringstream iss(text);
-	std::string line;
-	while (std::getline(iss, line)) {
-		if (!line.empty() && line.back() == '\r') line.pop_back();
-		t.cells.push_back(parseCsvLine(line));
+	// 행/필드 분리 (따옴표 안의 콤마/개행은 필드에 포함)
+	StatScope tokenizeScope(stats, StatPhase::Tokenize);
+	size_t cells = 0;
+	if (parseParts(text.size(), jobs) > 1) {
+		tokenizeParallel(&text[0], text.size(), true, jobs, t.rows, cells);
+	}
+	else {
+		CsvTokenizer tok;
+		tok.tokenizeInPlace(&text[0], text.size(), true, [&](const vector<string_view>& fields) {
+			t.rows.push(fields);
+			});
+		cells = t.rows.cells.size();
 	}
+	statAdd(stats, StatPhase::Tokenize, text.size(), t.rows.size(), cells);
 	return true;
 }
 
 
-vector<unordered_map<string, string>> sliceTable(
-	const Table& t, const SheetConf& sc, bool stopOnEmptyFirstCol
-) {
+// sliceTable 의 규칙을 한 행씩 적용한다. 전체 로드/스트리밍 경로가 함께 사용.
+// 시작 셀/컬럼 위치는 시트마다 한 번만 풀고, 값은 원본 필드를 트림한 view 로 낸다.
+struct RowSlicer {
+	const SheetConf& sc;
+	bool stopOnEmptyFirstCol;
 	CellPos st{ 0,0 };
-	a1ToRowCol(sc.startCell, st);
+	size_t rowIndex = 0;  // 지금까지 받은 행 수(= 다음 행의 0기반 번호)
+	bool stopped = false; // 종료 조건을 만나면 이후 행은 모두 무시
 
-	vector<unordered_map<string, string>> rows;
+	RowSlicer(const SheetConf& conf, bool stopOnEmpty) : sc(conf), stopOnEmptyFirstCol(stopOnEmpty) {
+		a1ToRowCol(sc.startCell, st);
+	}
 
-	for (size_t r = st.row; r < t.cells.size(); ++r) {
-		const auto& row = t.cells[r];
+	// row 를 values(sc.columns 순서)로 잘라내면 true. 건너뛰거나 종료되면 false.
+	// values 는 row 의 필드를 가리키므로 row 가 유효한 동안만 쓸 수 있다.
+	template <class Row>
+	bool next(const Row& row, vector<string_view>& values) {
+		size_t r = rowIndex++;
+		if (stopped || r < st.row) return false;
 		// 첫 컬럼 기준 종료 조건
 		if (stopOnEmptyFirstCol) {
-			string first = (st.col < row.size()) ? trim(row[st.col]) : "";
-			if (first.empty()) break;
+			string_view first = (st.col < row.size()) ? trim(row[st.col]) : string_view();
+			if (first.empty()) { stopped = true; return false; }
 		}
-		unordered_map<string, string> obj;
+		values.resize(sc.columns.size());
 		bool allEmpty = true;
 		for (size_t c = 0; c < sc.columns.size(); ++c) {
-			string val;
 			size_t col = st.col + c;
-			if (col < row.size()) val = trim(row[col]);
-			if (!val.empty()) allEmpty = false;
-			obj[sc.columns[c]] = val;
+			values[c] = (col < row.size()) ? trim(row[col]) : string_view();
+			if (!values[c].empty()) allEmpty = false;
 		}
 		if (allEmpty) {
-			if (stopOnEmptyFirstCol) break;
-			else continue;
+			if (stopOnEmptyFirstCol) stopped = true;
+			return false;
+		}
+		return true;
+	}
+};
+
+// 각 행은 sc.columns 순서의 값 배열(rows 의 필드를 가리키는 view)
+// rows 를 slicer 로 잘라 out 뒤에 붙인다. slicer 의 행 번호/종료 상태는 이어서 갱신된다.
+// 행이 많으면 구간별로 나눠 병렬로 자르고(구간마다 slicer 복사본, 시작 행 번호만 다름),
+// 앞 구간부터 이어 붙이다 종료된 구간에서 멈춘다 → 한 스레드로 자른 것과 같다.
+// 어느 구간이 종료되면 그 행 번호를 stopAt 에 남겨, 그보다 뒤의 행을 자르던 구간(결과가 버려질 쪽)은 바로 그만둔다.
+static void sliceRows(const CsvRows& rows, RowSlicer& slicer, unsigned jobs, CsvRows& out) {
+	if (slicer.stopped) return;
+	size_t n = rows.size();
+	unsigned parts = (unsigned)std::max<size_t>(1, std::min<size_t>(jobs, n / kParallelMinPartRows));
+	size_t step = n / parts;
+	// 구간 하나면 out 에 바로 쓴다
+	vector<CsvRows> partOut(parts > 1 ? parts : 0);
+	vector<char> partStopped(parts, 0);
+	size_t base = slicer.rowIndex;
+	std::atomic<size_t> stopAt{ n }; // 지금까지 종료된 가장 앞 행(rows 기준)
+	std::atomic<bool> cancel{ false };
+	parallelFor(parts, [&](unsigned k) {
+		size_t from = k * step;
+		size_t to = (k + 1 == parts) ? n : from + step;
+		CsvRows& dst = (parts > 1) ? partOut[k] : out;
+		RowSlicer s = slicer;
+		s.rowIndex = base + from;
+		vector<string_view> values;
+		for (size_t i = from; i < to; ++i) {
+			if (i > stopAt.load(std::memory_order_relaxed) || cancel.load(std::memory_order_relaxed)) break;
+			if (s.next(rows[i], values)) dst.push(values);
+			else if (s.stopped) {
+				size_t cur = stopAt.load(std::memory_order_relaxed);
+				while (i < cur && !stopAt.compare_exchange_weak(cur, i, std::memory_order_relaxed)) {}
+				break;
+			}
 		}
-		rows.push_back(std::move(obj));
+		partStopped[k] = s.stopped;
+		}, &cancel);
+	slicer.rowIndex = base + n;
+	for (unsigned k = 0; k < parts; ++k) {
+		if (parts > 1) out.append(partOut[k]);
+		if (partStopped[k]) { slicer.stopped = true; break; }
 	}
+}
+
+// 반환값의 필드는 t.text 를 가리킨다
+CsvRows sliceTable(
+	const Table& t, const SheetConf& sc, bool stopOnEmptyFirstCol, unsigned jobs = 1
+) {
+	RowSlicer slicer(sc, stopOnEmptyFirstCol);
+	CsvRows rows;
+	sliceRows(t.rows, slicer, jobs, rows);
 	return rows;
 }
 
-string toJson(const vector<unordered_map<string, string>>& rows) {
-	vector<string> arr;
-	arr.reserve(rows.size());
-	for (const auto& r : rows) {
-		vector<pair<string, string>> kv;
-		kv.reserve(r.size());
-		for (const auto& [k, v] : r) {
-			kv.push_back({ k, jsonString(v) });
+// -------------------- 스트리밍 변환 (메모리 상한 고정) --------------------
+// 파일을 고정 크기 청크로 읽고, 완성된 행만 토큰화 → 슬라이스 → JSON 으로 바로 내보낸다.
+// 메모리에는 청크 하나와 미완성 행 하나 정도만 남는다.
+// 청크는 마지막 '\n' 에서 자르므로(UTF-8/CP949 모두 멀티바이트 안에 0x0A 없음) 문자 중간이 잘리지 않는다.
+static const size_t kStreamChunkBytes = 1 << 20;
+
+// 파일을 청크 단위로 읽어 잘라낸 행(sc.columns 순서의 값, CsvRowView)마다 onValues(values) 호출.
+// values 는 콜백 안에서만 유효하다.
+// stats 가 있으면 onValues 안에서 쓴 시간은 valuesPhase 로 집계한다.
+// jobs > 1 이면 청크를 jobs 배로 키우고, 청크마다 토큰화/슬라이스를 병렬로 한 뒤 순서대로 넘긴다.
+// 인코딩은 첫 청크로 정하지만 UTF-8 이면 청크마다 다시 검증한다. auto 에서 뒤쪽 청크가 UTF-8 이 아니면
+// (통째로 읽었다면 CP949 로 판별됐을 파일) info->retryAsCp949 를 켜고 false — 호출자가 CP949 로 처음부터 다시 읽는다.
+template <class OnValues>
+bool streamCsvRows(const fs::path& file, const SheetConf& sc, const Config& cfg,
+	OnValues&& onValues, CsvReadInfo* info = nullptr,
+	SheetStats* stats = nullptr, StatPhase valuesPhase = StatPhase::Serialize, unsigned jobs = 1) {
+	StatScope readScope(stats, StatPhase::Read);
+	std::ifstream in(file, std::ios::binary);
+	if (!in) return false;
+
+	RowSlicer slicer(sc, cfg.stopOnEmptyFirstColumn);
+	CsvTokenizer tok;
+	vector<string_view> values;
+	size_t tokRows = 0, tokCells = 0, sliced = 0;
+	auto onRow = [&](const vector<string_view>& fields) {
+		++tokRows;
+		tokCells += fields.size();
+		bool ok;
+		{
+			StatScope sliceScope(stats, StatPhase::Slice);
+			ok = slicer.next(fields, values);
+		}
+		if (!ok) return;
+		++sliced;
+		StatScope valuesScope(stats, valuesPhase);
+		onValues(CsvRowView{ values.data(), values.size() });
+		};
+
+	std::string raw;   // 아직 변환하지 않은 원본 바이트
+	std::string text;  // UTF-8 로 변환됐지만 아직 행이 끝나지 않은 부분
+	std::string mode;
+	bool first = true;
+	size_t rawOffset = 0; // piece 의 파일 기준 시작 오프셋
+	vector<char> chunk(kStreamChunkBytes * std::max(1u, jobs));
+	CsvRows blockRows, blockValues; // 병렬 경로용(필드는 text 를 가리킨다)
+	while (!slicer.stopped) {
+		in.read(chunk.data(), (std::streamsize)chunk.size());
+		size_t got = (size_t)in.gcount();
+		bool eof = got < chunk.size();
+		raw.append(chunk.data(), got);
+		statAdd(stats, StatPhase::Read, got);
+
+		size_t cut = eof ? raw.size() : raw.rfind('\n');
+		if (cut == string::npos) continue; // 한 행이 청크보다 길다 → 더 읽는다
+		if (!eof) ++cut;
+
+		string piece = raw.substr(0, cut);
+		raw.erase(0, cut);
+		StatScope decodeScope(stats, StatPhase::Decode);
+		statAdd(stats, StatPhase::Decode, piece.size());
+		if (first) {
+			// 인코딩은 첫 청크로 판별
+			size_t bomLen = piece.size();
+			strip_utf8_bom(piece);
+			bomLen -= piece.size();
+			size_t invalidAt;
+			mode = resolveInputEncoding(piece, cfg.inputEncoding, invalidAt);
+			if (info) {
+				info->encoding = mode;
+				info->invalidUtf8At = (invalidAt == kUtf8Valid) ? kUtf8Valid : invalidAt + bomLen;
+			}
+			first = false;
+		}
+		else if (mode == "utf8") {
+			size_t invalidAt = utf8FirstInvalid(piece);
+			if (invalidAt != kUtf8Valid) {
+				if (cfg.inputEncoding == "auto") {
+					if (info) info->retryAsCp949 = true;
+					return false;
+				}
+				if (info && info->invalidUtf8At == kUtf8Valid) info->invalidUtf8At = rawOffset + invalidAt;
+			}
+		}
+		rawOffset += cut;
+		convertToUtf8(piece, mode);
+		text += piece;
+
+		StatScope tokenizeScope(stats, StatPhase::Tokenize);
+		size_t used;
+		if (parseParts(text.size(), jobs) > 1) {
+			blockRows.clear();
+			blockValues.clear();
+			used = tokenizeParallel(&text[0], text.size(), eof, jobs, blockRows, tokCells);
+			tokRows += blockRows.size();
+			{
+				StatScope sliceScope(stats, StatPhase::Slice);
+				sliceRows(blockRows, slicer, jobs, blockValues);
+			}
+			sliced += blockValues.size();
+			StatScope valuesScope(stats, valuesPhase);
+			for (size_t r = 0; r < blockValues.size(); ++r) onValues(blockValues[r]);
+		}
+		else {
+			used = tok.tokenize(text.data(), text.size(), eof, onRow);
+		}
+		statAdd(stats, StatPhase::Tokenize, used);
+		text.erase(0, used);
+		if (eof) break;
+	}
+	statAdd(stats, StatPhase::Tokenize, 0, tokRows, tokCells);
+	statAdd(stats, StatPhase::Slice, 0, sliced, sliced * sc.columns.size());
+	return !in.bad();
+}
+
+// -------------------- 시트 단위 변환 --------------------
+enum class OutputFormat { Json, Bin, Ndjson };
+
+static const char* outputExtension(OutputFormat f) {
+	switch (f) {
+	case OutputFormat::Bin: return ".bin";
+	case OutputFormat::Ndjson: return ".ndjson";
+	default: return ".json";
+	}
+}
+
+// 같은 시트의 다른 형식 출력을 지운다. 게임 쪽 로더는 있는 파일을 .bin > .ndjson > .json 순으로
+// 고르므로, 형식을 바꿔 변환한 뒤 예전 출력이 남아 있으면 그쪽(옛 데이터)을 읽게 된다.
+static void removeOtherOutputs(const fs::path& outputDir, const string& sheetName, OutputFormat keep, ostream& log) {
+	for (OutputFormat f : { OutputFormat::Json, OutputFormat::Bin, OutputFormat::Ndjson }) {
+		if (f == keep) continue;
+		std::error_code ec;
+		fs::path stale = outputDir / (sheetName + outputExtension(f));
+		if (fs::remove(stale, ec))
+			log << "[Clean] " << sheetName << ": removed stale " << stale << "\n";
+	}
+}
+
+enum class StatsFormat { None, Text, Json };
+
+// 명령행 옵션
+struct RunOptions {
+	bool forceStream = false; // --stream
+	unsigned jobs = 1;        // --jobs N (0 이면 코어 수)
+	bool force = false;       // --force : 매니페스트 무시하고 전부 다시 변환
+	OutputFormat format = OutputFormat::Json; // --format json|bin|ndjson
+	StatsFormat stats = StatsFormat::None;    // --stats[=text|json]
+	unsigned parseJobs = 0;   // --parse-jobs N : 큰 시트 하나를 나눠 파싱할 스레드 수 (0 이면 코어 수 / 시트 워커 수)
+};
+
+struct SheetJob {
+	fs::path input;
+	string sheetName;
+	const SheetConf* conf = nullptr; // nullptr 이면 설정 없음 → Skip
+};
+
+// 실제 변환 + 출력. 성공하면 true, 로그는 [OK]/[Error] 한 줄.
+// 작은 시트는 통째로 읽어 슬라이스하고, 큰 시트(또는 --stream)는 청크 단위로 흘려보낸다.
+// 타입 추론이 필요하면 먼저 한 번 훑어서 타입을 정한 뒤(스트리밍이면 파일을 두 번 읽음) 쓴다.
+// 스트리밍 중 인코딩을 CP949 로 바꿔 다시 읽어야 하면 retryAsCp949 를 켜고 false (로그 없음).
+static bool writeSheetOnce(const SheetJob& job, const Config& cfg, const fs::path& outFile,
+	uintmax_t inSize, const RunOptions& opt, ostream& log, SheetStats* stats, bool& retryAsCp949) {
+	const fs::path& p = job.input;
+	const SheetConf& sc = *job.conf;
+	bool stream = opt.forceStream || inSize >= cfg.streamThresholdBytes;
+	if (stats) stats->streamed = stream;
+	CsvReadInfo info;
+	auto warnEncoding = [&]() {
+		if (info.invalidUtf8At == kUtf8Valid || info.encoding != "utf8") return; // CP949 로 읽었으면 정상
+		log << "[Warn] " << job.sheetName << ": invalid UTF-8 at byte " << info.invalidUtf8At
+			<< " (read as " << info.encoding << ")\n";
+		};
+
+	Table t;
+	CsvRows rows; // t.text 를 가리킨다
+	if (!stream) {
+		if (!loadCsv(p, t, cfg.inputEncoding, &info, stats, opt.parseJobs)) {
+			log << "[Error] Failed to read: " << p << "\n";
+			return false;
+		}
+		StatScope sliceScope(stats, StatPhase::Slice);
+		rows = sliceTable(t, sc, cfg.stopOnEmptyFirstColumn, opt.parseJobs);
+		statAdd(stats, StatPhase::Slice, 0, rows.size(), rows.size() * sc.columns.size());
+	}
+	// 잘라낸 행을 차례로 fn(values) 에 넘긴다. fn 안의 시간은 phase 로 집계.
+	auto forEachRow = [&](auto&& fn, CsvReadInfo* readInfo, StatPhase phase) -> bool {
+		if (!stream) {
+			StatScope scope(stats, phase);
+			for (size_t r = 0; r < rows.size(); ++r) fn(rows[r]);
+			return true;
+		}
+		return streamCsvRows(p, sc, cfg, fn, readInfo, stats, phase, opt.parseJobs);
+		};
+
+	vector<ColumnSpec> types;
+	if (cfg.inferTypes && needsInference(sc.types, sc.columns.size())) {
+		ColumnTypeInfer infer(sc.columns.size());
+		size_t inferRows = 0;
+		CsvReadInfo inferInfo;
+		if (!forEachRow([&](const CsvRowView& v) { infer.add(v); ++inferRows; }, &inferInfo, StatPhase::Infer)) {
+			retryAsCp949 = inferInfo.retryAsCp949;
+			if (retryAsCp949) return false;
+			log << "[Error] Failed to read: " << p << "\n";
+			return false;
+		}
+		types = resolveColumnSpecs(sc.columns.size(), sc.types, &infer);
+		statAdd(stats, StatPhase::Infer, 0, inferRows, inferRows * sc.columns.size());
+	}
+	else {
+		types = resolveColumnSpecs(sc.columns.size(), sc.types, nullptr);
+	}
+
+	bool binary = (opt.format == OutputFormat::Bin);
+	ofstream out(outFile, binary ? (std::ios::out | std::ios::binary) : std::ios::out);
+	if (!out) {
+		log << "[Error] Cannot write: " << outFile << "\n";
+		return false;
+	}
+
+	bool readOk;
+	size_t rowCount;
+	if (binary) {
+		BinTableWriter writer(sc.columns, types);
+		readOk = forEachRow([&](const CsvRowView& v) { writer.writeRow(v); }, &info, StatPhase::Serialize);
+		if (readOk) {
+			StatScope writeScope(stats, StatPhase::Write);
+			if (!writer.save(out)) {
+				log << "[Error] Cannot write: " << outFile << "\n";
+				return false;
+			}
+			statAdd(stats, StatPhase::Write, (uint64_t)out.tellp());
+		}
+		rowCount = writer.rows();
+	}
+	else {
+		// NDJSON 은 줄 단위로 읽는 도구가 많아 BOM 을 붙이지 않는다(첫 줄이 깨진다)
+		bool lines = (opt.format == OutputFormat::Ndjson);
+		if (cfg.outputUtf8Bom && !lines) {
+			const unsigned char bom[3] = { 0xEF, 0xBB, 0xBF };
+			out.write(reinterpret_cast<const char*>(bom), 3);
 		}
-		// 정렬하면 출력이 안정적
-		sort(kv.begin(), kv.end(), [](auto& a, auto& b) {return a.first < b.first; });
-		arr.push_back(jsonObject(kv));
+		JsonTableWriter writer(sc.columns, types, lines);
+		string buf;
+		writer.begin(buf);
+		readOk = forEachRow([&](const CsvRowView& v) {
+			writer.writeRow(buf, v);
+			if (buf.size() >= JsonTableWriter::FlushBytes) {
+				StatScope writeScope(stats, StatPhase::Write);
+				statAdd(stats, StatPhase::Write, buf.size());
+				JsonTableWriter::flush(out, buf);
+			}
+			}, &info, StatPhase::Serialize);
+		writer.end(buf);
+		if (!lines) buf += '\n';
+		StatScope writeScope(stats, StatPhase::Write);
+		statAdd(stats, StatPhase::Write, buf.size());
+		JsonTableWriter::flush(out, buf);
+		rowCount = writer.rows();
+	}
+	statAdd(stats, StatPhase::Serialize, 0, rowCount, rowCount * sc.columns.size());
+	if (!readOk && info.retryAsCp949) {
+		retryAsCp949 = true;
+		return false;
+	}
+	if (!readOk) {
+		log << "[Error] Failed to read: " << p << "\n";
+		return false;
+	}
+	warnEncoding();
+	log << "[OK] " << job.sheetName << " -> " << outFile << " (" << rowCount << " rows"
+		<< (stream ? ", streamed" : "") << ")\n";
+	return true;
+}
+
+// 스트리밍 auto 모드에서 첫 청크 뒤에 UTF-8 이 아닌 바이트가 나오면 통째로 읽을 때(loadCsv)처럼
+// 파일 전체를 CP949 로 보고 처음부터 다시 변환한다(출력 파일도 새로 쓴다).
+static bool writeSheet(const SheetJob& job, const Config& cfg, const fs::path& outFile,
+	uintmax_t inSize, const RunOptions& opt, ostream& log, SheetStats* stats) {
+	// 다시 읽을 때는 버린 시도의 바이트/행이 더해지지 않도록 시작 전 통계로 되돌린다
+	SheetStats before;
+	if (stats) before = *stats;
+	bool retryAsCp949 = false;
+	bool ok = writeSheetOnce(job, cfg, outFile, inSize, opt, log, stats, retryAsCp949);
+	if (!retryAsCp949) return ok;
+	if (stats) *stats = before;
+	Config cp949 = cfg;
+	cp949.inputEncoding = "cp949";
+	return writeSheetOnce(job, cp949, outFile, inSize, opt, log, stats, retryAsCp949);
+}
+
+// 설정(시트 설정 + 출력에 영향을 주는 전역 옵션) 해시. 출력 형식이 바뀌면 kOutputFormatVersion 을 올린다.
+static const uint32_t kOutputFormatVersion = 2;
+
+static uint64_t sheetConfHash(const SheetConf& sc, const Config& cfg, const RunOptions& opt) {
+	Hash64 h;
+	h.update(&kOutputFormatVersion, sizeof(kOutputFormatVersion));
+	h.update(outputExtension(opt.format));
+	h.update(sc.startCell); h.update("\0", 1);
+	for (const auto& c : sc.columns) { h.update(c); h.update("\0", 1); }
+	for (const auto& t : sc.types) {
+		h.update(columnTypeName(t.type));
+		for (const auto& e : t.enumValues) { h.update("|", 1); h.update(e); }
+		h.update("\0", 1);
 	}
-	return jsonArray(arr);
+	h.update(cfg.inputEncoding); h.update("\0", 1);
+	char flags[3] = { (char)cfg.stopOnEmptyFirstColumn, (char)cfg.outputUtf8Bom, (char)cfg.inferTypes };
+	h.update(flags, sizeof(flags));
+	return h.digest();
+}
+
+struct SheetResult {
+	string log;
+	bool hasEntry = false;  // true 면 매니페스트에 entry 를 기록, false 면 지운다
+	ManifestEntry entry;
+	SheetStats stats;       // opt.stats 가 켜져 있을 때만 채운다
+};
+
+// 시트 하나를 (필요하면) 변환하고 [OK]/[Error]/[Skip] 로그를 돌려준다.
+// 여러 스레드에서 동시에 호출되므로 공유 상태(cerr 포함)를 건드리지 않는다(manifest 는 읽기만).
+static SheetResult convertSheet(const SheetJob& job, const Config& cfg, const fs::path& outputDir,
+	const Manifest& manifest, const RunOptions& opt) {
+	SheetResult res;
+	ostringstream log;
+	SheetStats* stats = (opt.stats != StatsFormat::None) ? &res.stats : nullptr;
+	if (stats) {
+		stats->sheet = job.sheetName;
+		stats->begin();
+	}
+	auto finish = [&](const char* status) {
+		res.log = log.str();
+		if (stats) {
+			stats->status = status;
+			stats->finish();
+		}
+		return std::move(res);
+		};
+	if (!job.conf) {
+		// 설정에 없으면 스킵(원하면 기본 규칙으로 처리하도록 바꿀 수 있음)
+		log << "[Skip] No config for sheet: " << job.sheetName << "\n";
+		return finish("skip");
+	}
+
+	fs::path outFile = outputDir / (job.sheetName + outputExtension(opt.format));
+	std::error_code ec;
+	ManifestEntry cur;
+	cur.size = fs::file_size(job.input, ec);
+	if (ec) cur.size = 0;
+	cur.mtime = (long long)fs::last_write_time(job.input, ec).time_since_epoch().count();
+	cur.confHash = sheetConfHash(*job.conf, cfg, opt);
+	// 매니페스트용 입력 해시
+	auto hashInput = [&](uint64_t& out) {
+		StatScope hashScope(stats, StatPhase::Hash);
+		bool ok = hashFile(job.input, out);
+		if (ok) statAdd(stats, StatPhase::Hash, cur.size);
+		return ok;
+		};
+
+	// 증분: 설정이 같고 출력이 남아 있으면 입력 내용만 비교
+	const ManifestEntry* prev = manifest.find(job.sheetName);
+	bool haveContentHash = false;
+	if (!opt.force && prev && prev->confHash == cur.confHash && fs::exists(outFile, ec)) {
+		bool same = false;
+		if (prev->size == cur.size && prev->mtime == cur.mtime) {
+			same = true;
+		}
+		else if (prev->size == cur.size && hashInput(cur.contentHash)) {
+			haveContentHash = true;
+			same = (cur.contentHash == prev->contentHash);
+		}
+		if (same) {
+			cur.contentHash = prev->contentHash;
+			log << "[UpToDate] " << job.sheetName << " -> " << outFile << "\n";
+			removeOtherOutputs(outputDir, job.sheetName, opt.format, log);
+			res.hasEntry = true;
+			res.entry = cur;
+			return finish("uptodate");
+		}
+	}
+
+	bool written = false;
+	try {
+		written = writeSheet(job, cfg, outFile, cur.size, opt, log, stats);
+	}
+	catch (const std::exception& e) {
+		// 타입 불일치 등으로 중간에 멈춘 출력은 남기지 않는다
+		fs::remove(outFile, ec);
+		log << "[Error] " << job.sheetName << ": " << e.what() << "\n";
+	}
+	if (written) {
+		removeOtherOutputs(outputDir, job.sheetName, opt.format, log);
+		if (haveContentHash || hashInput(cur.contentHash)) {
+			res.hasEntry = true;
+			res.entry = cur;
+		}
+	}
+	return finish(written ? "ok" : "error");
+}
+
+// 시트들을 opt.jobs 개의 워커로 나눠 변환한다.
+// 로그는 완료 순서와 무관하게 jobs 순서대로 출력되고, 한 시트의 실패가 다른 시트를 막지 않는다.
+// opt.stats 가 켜져 있으면 시트별 통계를 jobs 순서대로 stats 에 담는다. 실제로 돌린 워커 수를 돌려준다.
+static unsigned convertAllSheets(const vector<SheetJob>& jobs, const Config& cfg, const fs::path& outputDir,
+	Manifest& manifest, const RunOptions& opt, vector<SheetStats>& stats) {
+	vector<SheetResult> results(jobs.size());
+	vector<char> done(jobs.size(), 0);
+	std::mutex m;
+	std::condition_variable cv;
+	std::atomic<size_t> next{ 0 };
+
+	unsigned hw = std::thread::hardware_concurrency();
+	unsigned n = opt.jobs ? opt.jobs : std::max(1u, hw);
+	n = (unsigned)std::min<size_t>(n, std::max<size_t>(jobs.size(), 1));
+	// 시트 단위로 다 못 쓰는 코어는 시트 하나를 나눠 파싱하는 데 쓴다(출력은 같다).
+	RunOptions run = opt;
+	if (!run.parseJobs) run.parseJobs = std::max(1u, hw / n);
+
+	auto worker = [&]() {
+		while (true) {
+			size_t i = next.fetch_add(1);
+			if (i >= jobs.size()) break;
+			SheetResult r;
+			try { r = convertSheet(jobs[i], cfg, outputDir, manifest, run); }
+			catch (const std::exception& e) { r.log = "[Error] " + jobs[i].sheetName + ": " + e.what() + "\n"; }
+			catch (...) { r.log = "[Error] " + jobs[i].sheetName + ": unknown error\n"; }
+			{
+				std::lock_guard<std::mutex> lk(m);
+				results[i] = std::move(r);
+				done[i] = 1;
+			}
+			cv.notify_one();
+		}
+		};
+
+	vector<std::thread> pool;
+	if (n > 1) for (unsigned k = 0; k < n; ++k) pool.emplace_back(worker);
+	else worker();
+	// 메인 스레드는 순서대로 로그만 내보낸다.
+	for (size_t i = 0; i < jobs.size(); ++i) {
+		std::unique_lock<std::mutex> lk(m);
+		cv.wait(lk, [&] { return done[i] != 0; });
+		cerr << results[i].log;
+	}
+	for (auto& th : pool) th.join();
+
+	// 매니페스트 갱신은 워커가 끝난 뒤 한 번에
+	for (size_t i = 0; i < jobs.size(); ++i) {
+		if (!jobs[i].conf) continue;
+		if (results[i].hasEntry) manifest.set(jobs[i].sheetName, results[i].entry);
+		else manifest.erase(jobs[i].sheetName);
+	}
+
+	if (opt.stats != StatsFormat::None) {
+		for (size_t i = 0; i < jobs.size(); ++i) {
+			SheetStats& st = results[i].stats;
+			if (st.status.empty()) { // convertSheet 밖으로 예외가 나온 경우
+				st.sheet = jobs[i].sheetName;
+				st.status = "error";
+			}
+			stats.push_back(std::move(st));
+		}
+	}
+	return n;
 }
 
 // -------------------- 메인 --------------------
@@ -422,14 +1028,59 @@ int main(int argc, char** argv) {
 	ios::sync_with_stdio(false);
 	cin.tie(nullptr);
 
-	if (argc < 3) {
-		cerr << "Usage: " << argv[0] << " <input_dir> <output_dir> [config.json]\n";
+	// 위치 인자: <input_dir> <output_dir> [config.json], 옵션: --로 시작
+	vector<string> positional;
+	RunOptions opt;
+	for (int a = 1; a < argc; ++a) {
+		string arg = argv[a];
+		if (arg == "--stream") opt.forceStream = true;
+		else if (arg == "--stats" || arg == "--stats=text") opt.stats = StatsFormat::Text;
+		else if (arg == "--stats=json") opt.stats = StatsFormat::Json;
+		else if (arg == "--force") opt.force = true;
+		else if (arg == "--format" || arg.rfind("--format=", 0) == 0) {
+			string v = (arg == "--format") ? (a + 1 < argc ? argv[++a] : "") : arg.substr(9);
+			if (v == "json") opt.format = OutputFormat::Json;
+			else if (v == "bin") opt.format = OutputFormat::Bin;
+			else if (v == "ndjson") opt.format = OutputFormat::Ndjson;
+			else {
+				cerr << "Invalid --format value: " << v << " (json|bin|ndjson)\n";
+				return 1;
+			}
+		}
+		else if (arg == "--jobs" || arg.rfind("--jobs=", 0) == 0) {
+			string v = (arg == "--jobs") ? (a + 1 < argc ? argv[++a] : "") : arg.substr(7);
+			char* end = nullptr;
+			unsigned long n = std::strtoul(v.c_str(), &end, 10);
+			if (v.empty() || *end != '\0') {
+				cerr << "Invalid --jobs value: " << v << "\n";
+				return 1;
+			}
+			opt.jobs = (unsigned)n;
+		}
+		else if (arg == "--parse-jobs" || arg.rfind("--parse-jobs=", 0) == 0) {
+			string v = (arg == "--parse-jobs") ? (a + 1 < argc ? argv[++a] : "") : arg.substr(13);
+			char* end = nullptr;
+			unsigned long n = std::strtoul(v.c_str(), &end, 10);
+			if (v.empty() || *end != '\0') {
+				cerr << "Invalid --parse-jobs value: " << v << "\n";
+				return 1;
+			}
+			opt.parseJobs = (unsigned)n;
+		}
+		else if (arg.rfind("--", 0) == 0) {
+			cerr << "Unknown option: " << arg << "\n";
+			return 1;
+		}
+		else positional.push_back(arg);
+	}
+	if (positional.size() < 2) {
+		cerr << "Usage: " << argv[0] << " <input_dir> <output_dir> [config.json] [--stream] [--jobs N] [--parse-jobs N] [--force] [--format json|bin|ndjson] [--stats[=json]]\n";
 		return 1;
 	}
-	fs::path inputDir = argv[1];
-	fs::path outputDir = argv[2];
+	fs::path inputDir = positional[0];
+	fs::path outputDir = positional[1];
 	fs::path configPath;
-	if (argc >= 4) configPath = argv[3];
+	if (positional.size() >= 3) configPath = positional[2];
 
 	if (!fs::exists(inputDir) || !fs::is_directory(inputDir)) {
 		cerr << "Input dir not found: " << inputDir << "\n";
@@ -444,49 +1095,42 @@ int main(int argc, char** argv) {
 	}
 
 	Config cfg;
-	// 기본 설정(예시). config.json이 있으면 덮어씌움.
+	// 기본 설정: 게임 테이블 스키마. config.json이 있으면 덮어씌움.
 	cfg.sheets = {
-		{"Item", SheetConf{ "A2", {"Idx","Name","Type","Value","Effect"} }},
-		{"Shop", SheetConf{ "A2", {"ShopId","ItemIdx","Price","Stock"} }}
+		schemaSheetConf<ItemSchema>(),
+		schemaSheetConf<ShopSchema>()
 	};
 	loadConfigJson(configPath, cfg);
 
-	// 입력 폴더의 *.csv 반복
+	// 입력 폴더의 *.csv 수집 (출력 순서가 매번 같도록 경로순 정렬)
+	vector<SheetJob> jobs;
 	for (auto& entry : fs::directory_iterator(inputDir)) {
 		if (!entry.is_regular_file()) continue;
 		auto p = entry.path();
 		if (p.extension() != ".csv") continue;
 
-		string sheetName = p.stem().string(); // "Item.csv" -> "Item"
-		auto it = cfg.sheets.find(sheetName);
-		if (it == cfg.sheets.end()) {
-			// 설정에 없으면 스킵(원하면 기본 규칙으로 처리하도록 바꿀 수 있음)
-			cerr << "[Skip] No config for sheet: " << sheetName << "\n";
-			continue;
-		}
-
-		Table t;
-		if (!loadCsv(p, t, cfg.inputEncoding)) {
-			cerr << "[Error] Failed to read: " << p << "\n";
-			continue;
-		}
-		auto rows = sliceTable(t, it->second, cfg.stopOnEmptyFirstColumn);
-		string j = toJson(rows);
-
-		fs::path outFile = outputDir / (sheetName + ".json");
-		ofstream out(outFile);
-		if (!out) {
-			cerr << "[Error] Cannot write: " << outFile << "\n";
-			continue;
-		}
+		SheetJob job;
+		job.input = p;
+		job.sheetName = p.stem().string(); // "Item.csv" -> "Item"
+		auto it = cfg.sheets.find(job.sheetName);
+		if (it != cfg.sheets.end()) job.conf = &it->second;
+		jobs.push_back(std::move(job));
+	}
+	sort(jobs.begin(), jobs.end(), [](const SheetJob& a, const SheetJob& b) { return a.input < b.input; });
 
-		if (cfg.outputUtf8Bom) {
-			const unsigned char bom[3] = { 0xEF, 0xBB, 0xBF };
-			out.write(reinterpret_cast<const char*>(bom), 3);
-		}
-		out << j << "\n";
-		cerr << "[OK] " << sheetName << " -> " << outFile << " (" << rows.size() << " rows)\n";
+	auto started = std::chrono::steady_clock::now();
+	Manifest manifest;
+	manifest.load(outputDir);
+	vector<SheetStats> stats;
+	unsigned workers = convertAllSheets(jobs, cfg, outputDir, manifest, opt, stats);
+	if (!manifest.save(outputDir)) {
+		cerr << "[Warn] Cannot write manifest in: " << outputDir << "\n";
 	}
 
+	// 로그는 stderr 이므로 JSON 은 stdout 에 그대로 (리다이렉트해서 대시보드로)
+	double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+	if (opt.stats == StatsFormat::Text) printStatsText(cerr, stats, wall);
+	else if (opt.stats == StatsFormat::Json) writeStatsJson(cout, stats, wall, workers);
+
 	return 0;
 }
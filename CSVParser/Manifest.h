@@ -0,0 +1,163 @@
+// Manifest.h : 증분 변환용 매니페스트
+// 출력 폴더에 시트별 (입력 크기, 수정 시각, 내용 해시, 설정 해시)를 기록해 두고,
+// 다음 실행에서 둘 다 같으면 변환을 건너뛴다.
+// - 크기/수정 시각이 같으면 파일을 읽지 않고 바로 "변경 없음"
+// - 다르면 내용을 해시해서 비교(타임스탬프만 바뀐 경우도 건너뜀)
+// 저장할 때는 이번 실행에서 set() 한 시트만 남긴다(지워지거나 이름이 바뀐 CSV 의 항목은 버린다).
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// -------------------- 64비트 해시 (XXH64) --------------------
+class Hash64 {
+public:
+	explicit Hash64(uint64_t seed = 0) {
+		v[0] = seed + P1 + P2; v[1] = seed + P2; v[2] = seed; v[3] = seed - P1;
+		this->seed = seed;
+	}
+
+	void update(const void* data, size_t len) {
+		const unsigned char* p = static_cast<const unsigned char*>(data);
+		total += len;
+		if (bufLen + len < 32) {
+			std::memcpy(buf + bufLen, p, len);
+			bufLen += len;
+			return;
+		}
+		if (bufLen) {
+			size_t fill = 32 - bufLen;
+			std::memcpy(buf + bufLen, p, fill);
+			stripe(buf);
+			p += fill; len -= fill; bufLen = 0;
+		}
+		while (len >= 32) { stripe(p); p += 32; len -= 32; }
+		if (len) { std::memcpy(buf, p, len); bufLen = len; }
+	}
+	void update(const std::string& s) { update(s.data(), s.size()); }
+
+	uint64_t digest() const {
+		uint64_t h;
+		if (total >= 32) {
+			h = rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18);
+			for (int k = 0; k < 4; ++k) h = (h ^ round(0, v[k])) * P1 + P4;
+		}
+		else {
+			h = seed + P5;
+		}
+		h += total;
+		const unsigned char* p = buf;
+		size_t len = bufLen;
+		while (len >= 8) { h ^= round(0, read64(p)); h = rotl(h, 27) * P1 + P4; p += 8; len -= 8; }
+		if (len >= 4) { h ^= (uint64_t)read32(p) * P1; h = rotl(h, 23) * P2 + P3; p += 4; len -= 4; }
+		while (len) { h ^= (*p) * P5; h = rotl(h, 11) * P1; ++p; --len; }
+		h ^= h >> 33; h *= P2; h ^= h >> 29; h *= P3; h ^= h >> 32;
+		return h;
+	}
+
+private:
+	static constexpr uint64_t P1 = 11400714785074694791ull;
+	static constexpr uint64_t P2 = 14029467366897019727ull;
+	static constexpr uint64_t P3 = 1609587929392839161ull;
+	static constexpr uint64_t P4 = 9650029242287828579ull;
+	static constexpr uint64_t P5 = 2870177450012600261ull;
+
+	static uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+	static uint64_t round(uint64_t acc, uint64_t in) { acc += in * P2; acc = rotl(acc, 31); return acc * P1; }
+	static uint64_t read64(const unsigned char* p) { uint64_t x; std::memcpy(&x, p, 8); return x; }
+	static uint32_t read32(const unsigned char* p) { uint32_t x; std::memcpy(&x, p, 4); return x; }
+	void stripe(const unsigned char* p) {
+		for (int k = 0; k < 4; ++k) v[k] = round(v[k], read64(p + 8 * k));
+	}
+
+	uint64_t v[4];
+	uint64_t seed;
+	uint64_t total = 0;
+	unsigned char buf[32];
+	size_t bufLen = 0;
+};
+
+// 파일 내용 해시. 실패하면 false.
+static inline bool hashFile(const std::filesystem::path& file, uint64_t& out) {
+	std::ifstream in(file, std::ios::binary);
+	if (!in) return false;
+	Hash64 h;
+	std::vector<char> chunk(1 << 20);
+	while (in) {
+		in.read(chunk.data(), (std::streamsize)chunk.size());
+		h.update(chunk.data(), (size_t)in.gcount());
+	}
+	if (in.bad()) return false;
+	out = h.digest();
+	return true;
+}
+
+// -------------------- 매니페스트 --------------------
+struct ManifestEntry {
+	uintmax_t size = 0;
+	long long mtime = 0;       // file_time_type 의 tick (같은 머신/빌드에서만 비교)
+	uint64_t contentHash = 0;
+	uint64_t confHash = 0;
+};
+
+class Manifest {
+public:
+	static constexpr const char* FileName = ".csvparser-manifest";
+
+	// 파일이 없거나 깨져 있으면 빈 매니페스트(= 전부 다시 변환)
+	void load(const std::filesystem::path& outputDir) {
+		entries.clear();
+		visited.clear();
+		std::ifstream in(outputDir / FileName);
+		std::string line;
+		if (!std::getline(in, line) || line != Header) return;
+		while (std::getline(in, line)) {
+			std::istringstream ls(line);
+			std::string name;
+			ManifestEntry e;
+			if (!std::getline(ls, name, '\t')) continue;
+			ls >> e.size >> e.mtime >> std::hex >> e.contentHash >> e.confHash;
+			if (ls.fail()) continue;
+			entries[name] = e;
+		}
+	}
+
+	bool save(const std::filesystem::path& outputDir) const {
+		std::filesystem::path tmp = outputDir / (std::string(FileName) + ".tmp");
+		{
+			std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+			if (!out) return false;
+			out << Header << '\n';
+			for (const auto& [name, e] : entries) {
+				if (!visited.count(name)) continue;
+				out << name << '\t' << e.size << ' ' << e.mtime << ' '
+					<< std::hex << e.contentHash << ' ' << e.confHash << std::dec << '\n';
+			}
+			if (!out) return false;
+		}
+		std::error_code ec;
+		std::filesystem::rename(tmp, outputDir / FileName, ec);
+		return !ec;
+	}
+
+	const ManifestEntry* find(const std::string& name) const {
+		auto it = entries.find(name);
+		return it == entries.end() ? nullptr : &it->second;
+	}
+	void set(const std::string& name, const ManifestEntry& e) {
+		entries[name] = e;
+		visited.insert(name);
+	}
+	void erase(const std::string& name) { entries.erase(name); }
+
+private:
+	static constexpr const char* Header = "csvparser-manifest 1";
+	std::map<std::string, ManifestEntry> entries; // 이름순 → 파일 내용이 매번 같다
+	std::set<std::string> visited;                // 이번 실행에서 set() 한 시트 (save 가 이것만 쓴다)
+};
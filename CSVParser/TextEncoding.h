@@ -0,0 +1,306 @@
+// TextEncoding.h : 입력 인코딩 판별/변환 헬퍼
+// - utf8FirstInvalid : 전체 규격 UTF-8 검증(overlong, 서로게이트, U+10FFFF 초과 포함)
+//   AVX2 는 룩업 테이블 방식(Keiser-Lemire)으로 32바이트씩 검사하고,
+//   SSE2 는 순수 ASCII 블록만 건너뛰고 나머지는 스칼라로 검사한다.
+//   오류가 보이면 해당 문자 시작점부터 스칼라로 다시 훑어 정확한 오프셋을 낸다.
+// - cp949ToUtf8 : CP949(UHC, EUC-KR 상위 집합) → UTF-8. 플랫폼 API 없이 내장 표로 변환하고,
+//   ASCII 구간은 SIMD 로 16/32바이트씩 그대로 복사한다.
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "Cp949Table.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static const size_t kUtf8Valid = (size_t)-1;
+
+// -------------------- 스칼라 검증 --------------------
+// p[i, n) 을 검사. 첫 잘못된 시퀀스의 시작 오프셋, 모두 유효하면 kUtf8Valid.
+static inline size_t utf8FirstInvalidScalar(const unsigned char* p, size_t i, size_t n) {
+	while (i < n) {
+		unsigned char c = p[i];
+		if (c < 0x80) { ++i; continue; }
+		size_t len;
+		unsigned char lo = 0x80, hi = 0xBF; // 두 번째 바이트 허용 범위
+		if (c >= 0xC2 && c <= 0xDF) len = 2;
+		else if (c >= 0xE0 && c <= 0xEF) {
+			len = 3;
+			if (c == 0xE0) lo = 0xA0;      // overlong
+			else if (c == 0xED) hi = 0x9F; // 서로게이트(U+D800..DFFF)
+		}
+		else if (c >= 0xF0 && c <= 0xF4) {
+			len = 4;
+			if (c == 0xF0) lo = 0x90;      // overlong
+			else if (c == 0xF4) hi = 0x8F; // U+10FFFF 초과
+		}
+		else return i;                     // 80..C1, F5..FF
+		if (i + len > n) return i;
+		if (p[i + 1] < lo || p[i + 1] > hi) return i;
+		for (size_t k = 2; k < len; ++k)
+			if ((p[i + k] & 0xC0) != 0x80) return i;
+		i += len;
+	}
+	return kUtf8Valid;
+}
+
+// i 이전까지는 검증이 끝났다고 볼 때, i 경계에 걸친 문자를 다시 볼 수 있는 시작점.
+// 경계에 걸친 문자의 선두 바이트는 [i-3, i) 안에 있으므로 거기서 연속 바이트만 건너뛴다.
+static inline size_t utf8ResyncPoint(const unsigned char* p, size_t i) {
+	size_t from = (i >= 3) ? i - 3 : 0;
+	while (from < i && (p[from] & 0xC0) == 0x80) ++from;
+	return from;
+}
+
+#if defined(__AVX2__)
+// -------------------- AVX2 룩업 검증 --------------------
+namespace utf8_avx2 {
+	static const uint8_t TOO_SHORT = 1 << 0;
+	static const uint8_t TOO_LONG = 1 << 1;
+	static const uint8_t OVERLONG_3 = 1 << 2;
+	static const uint8_t TOO_LARGE = 1 << 3;
+	static const uint8_t SURROGATE = 1 << 4;
+	static const uint8_t OVERLONG_2 = 1 << 5;
+	static const uint8_t TOO_LARGE_1000 = 1 << 6;
+	static const uint8_t OVERLONG_4 = 1 << 6;
+	static const uint8_t TWO_CONTS = 1 << 7;
+	static const uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+	static inline __m256i table16(uint8_t t0, uint8_t t1, uint8_t t2, uint8_t t3, uint8_t t4, uint8_t t5,
+		uint8_t t6, uint8_t t7, uint8_t t8, uint8_t t9, uint8_t t10, uint8_t t11, uint8_t t12,
+		uint8_t t13, uint8_t t14, uint8_t t15) {
+		return _mm256_setr_epi8(
+			(char)t0, (char)t1, (char)t2, (char)t3, (char)t4, (char)t5, (char)t6, (char)t7,
+			(char)t8, (char)t9, (char)t10, (char)t11, (char)t12, (char)t13, (char)t14, (char)t15,
+			(char)t0, (char)t1, (char)t2, (char)t3, (char)t4, (char)t5, (char)t6, (char)t7,
+			(char)t8, (char)t9, (char)t10, (char)t11, (char)t12, (char)t13, (char)t14, (char)t15);
+	}
+
+	// input 앞에 prev 의 마지막 N 바이트를 붙인 것 (바이트 단위 이동)
+	template <int N>
+	static inline __m256i prevN(__m256i input, __m256i prev) {
+		return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+	}
+
+	static inline __m256i hi4(__m256i v) { return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F)); }
+	static inline __m256i lo4(__m256i v) { return _mm256_and_si256(v, _mm256_set1_epi8(0x0F)); }
+
+	static inline __m256i checkSpecial(__m256i input, __m256i prev1) {
+		const __m256i b1h = table16(
+			TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+			TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+			TOO_SHORT | OVERLONG_2,
+			TOO_SHORT,
+			TOO_SHORT | OVERLONG_3 | SURROGATE,
+			TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+		const __m256i b1l = table16(
+			CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+			CARRY | OVERLONG_2,
+			CARRY, CARRY,
+			CARRY | TOO_LARGE,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000,
+			CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+			CARRY | TOO_LARGE | TOO_LARGE_1000, CARRY | TOO_LARGE | TOO_LARGE_1000);
+		const __m256i b2h = table16(
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+			TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+			TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+		__m256i a = _mm256_shuffle_epi8(b1h, hi4(prev1));
+		__m256i b = _mm256_shuffle_epi8(b1l, lo4(prev1));
+		__m256i c = _mm256_shuffle_epi8(b2h, hi4(input));
+		return _mm256_and_si256(_mm256_and_si256(a, b), c);
+	}
+
+	// 32바이트 블록 오류 벡터(0 이면 유효). prev 는 직전 블록.
+	static inline __m256i checkBlock(__m256i input, __m256i prev) {
+		__m256i prev1 = prevN<1>(input, prev);
+		__m256i sc = checkSpecial(input, prev1);
+		__m256i prev2 = prevN<2>(input, prev);
+		__m256i prev3 = prevN<3>(input, prev);
+		__m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+		__m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+		__m256i must23 = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+		return _mm256_xor_si256(must23, sc);
+	}
+}
+#endif
+
+// -------------------- 진입점 --------------------
+static inline size_t utf8FirstInvalid(const char* data, size_t n) {
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	size_t i = 0;
+#if defined(__AVX2__)
+	__m256i prev = _mm256_setzero_si256();
+	__m256i err = _mm256_setzero_si256();
+	// 블록 끝에서 끝나지 않은 멀티바이트 시작(다음 블록 첫 바이트들이 ASCII 면 오류)
+	const __m256i incompleteMax = _mm256_setr_epi8(
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		(char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+	__m256i prevIncomplete = _mm256_setzero_si256();
+	for (; i + 32 <= n; i += 32) {
+		__m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+		if (_mm256_movemask_epi8(in) == 0) {
+			err = _mm256_or_si256(err, prevIncomplete); // ASCII 블록
+		}
+		else {
+			err = _mm256_or_si256(err, utf8_avx2::checkBlock(in, prev));
+			prevIncomplete = _mm256_subs_epu8(in, incompleteMax);
+		}
+		if (!_mm256_testz_si256(err, err)) {
+			// 이 블록(또는 직전 블록에서 이어진 문자)에 오류 → 스칼라로 정확한 위치
+			return utf8FirstInvalidScalar(p, utf8ResyncPoint(p, i), n);
+		}
+		if (_mm256_movemask_epi8(in) == 0) prevIncomplete = _mm256_setzero_si256();
+		prev = in;
+	}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	// 순수 ASCII 16바이트 블록은 건너뛰고, 아닌 곳은 스칼라로 한 문자씩
+	while (i + 16 <= n) {
+		__m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+		if (_mm_movemask_epi8(in) == 0) { i += 16; continue; }
+		// 비 ASCII 구간: 다음 ASCII 블록까지 스칼라로
+		size_t stop = i + 16;
+		while (i < stop) {
+			unsigned char c = p[i];
+			if (c < 0x80) { ++i; continue; }
+			size_t len = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : 2;
+			size_t end = (i + len <= n) ? i + len : n;
+			if (utf8FirstInvalidScalar(p, i, end) != kUtf8Valid || end != i + len) return i;
+			i = end;
+		}
+	}
+#endif
+	// 남은 꼬리(및 마지막 블록에서 이어진 문자)는 스칼라로
+	return utf8FirstInvalidScalar(p, utf8ResyncPoint(p, i), n);
+}
+
+static inline size_t utf8FirstInvalid(const std::string& s) { return utf8FirstInvalid(s.data(), s.size()); }
+
+// -------------------- CP949 → UTF-8 --------------------
+// 2바이트 문자(리드 81..FE, 트레일 41..FE)를 바로 찾는 평평한 표.
+// Cp949Table.h 의 압축 데이터로 처음 쓸 때 한 번 만든다(126 x 190 x 2바이트, 약 47KB).
+struct Cp949Map {
+	static const unsigned Trails = 0xFE - 0x41 + 1;
+	uint16_t u[(0xFE - 0x81 + 1) * Trails]; // 0 이면 매핑 없음
+
+	Cp949Map() : u() {
+		// 한글: KS X 1001 에 있으면 B0A1 부터 차례로, 없으면 UHC 확장 칸(8141 부터)에 차례로
+		unsigned ks = 0;
+		unsigned el = 0x81, et = 0x41;
+		for (unsigned i = 0; i < 11172; ++i) {
+			uint16_t cp = (uint16_t)(0xAC00 + i);
+			if ((kCp949KsHangulBits[i >> 5] >> (i & 31)) & 1) {
+				set(0xB0 + ks / 94, 0xA1 + ks % 94, cp);
+				++ks;
+				continue;
+			}
+			set(el, et, cp);
+			if (++et == 0x5B) et = 0x61;
+			else if (et == 0x7B) et = 0x81;
+			else if (et > (el < 0xA1 ? 0xFEu : 0xA0u)) { ++el; et = 0x41; }
+		}
+		for (unsigned k = 0; k < 12 * 94; ++k) set(0xA1 + k / 94, 0xA1 + k % 94, kCp949Symbols[k]);
+		for (unsigned k = 0; k < 52 * 94; ++k) set(0xCA + k / 94, 0xA1 + k % 94, kCp949Hanja[k]);
+	}
+
+	uint16_t find(unsigned lead, unsigned trail) const {
+		if (lead < 0x81 || lead > 0xFE || trail < 0x41 || trail > 0xFE) return 0;
+		return u[(lead - 0x81) * Trails + (trail - 0x41)];
+	}
+
+private:
+	void set(unsigned lead, unsigned trail, uint16_t cp) { u[(lead - 0x81) * Trails + (trail - 0x41)] = cp; }
+};
+
+static inline const Cp949Map& cp949Map() {
+	static const Cp949Map m; // C++11 부터 초기화는 스레드 안전
+	return m;
+}
+
+static inline unsigned encCtz32(uint32_t x) {
+#if defined(_MSC_VER)
+	unsigned long idx; _BitScanForward(&idx, (unsigned long)x); return (unsigned)idx;
+#else
+	return (unsigned)__builtin_ctz(x);
+#endif
+}
+
+// 잘못된 바이트(짝이 없는 리드, 단독 80/FF 등)는 U+FFFD 하나로 바꾼다.
+static inline std::string cp949ToUtf8(const char* data, size_t n) {
+	const Cp949Map& map = cp949Map();
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+	// 2바이트 → 3바이트가 최악(1.5배). SIMD 복사는 블록 하나를 통째로 쓰므로 32바이트 여유.
+	std::string out;
+	out.resize(n + n / 2 + 32);
+	char* o = &out[0];
+	size_t i = 0, w = 0;
+	while (i < n) {
+		// ASCII 구간: 블록을 일단 통째로 쓰고, 첫 비 ASCII 위치만큼만 전진
+#if defined(__AVX2__)
+		for (; i + 32 <= n; ) {
+			__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(o + w), v);
+			uint32_t mask = (uint32_t)_mm256_movemask_epi8(v);
+			if (!mask) { i += 32; w += 32; continue; }
+			unsigned k = encCtz32(mask);
+			i += k; w += k;
+			break;
+		}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		for (; i + 16 <= n; ) {
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(o + w), v);
+			uint32_t mask = (uint32_t)_mm_movemask_epi8(v);
+			if (!mask) { i += 16; w += 16; continue; }
+			unsigned k = encCtz32(mask);
+			i += k; w += k;
+			break;
+		}
+#endif
+		while (i < n && p[i] < 0x80) o[w++] = (char)p[i++];
+		if (i >= n) break;
+
+		uint32_t cp = (i + 1 < n) ? map.find(p[i], p[i + 1]) : 0;
+		if (cp) {
+			i += 2;
+		}
+		else {
+			cp = 0xFFFD;
+			i += 1;
+			// 1바이트 → 3바이트라 1.5배 여유가 깨질 수 있다 → 남은 입력 기준으로 다시 확보
+			size_t need = w + 3 + (n - i) + (n - i) / 2 + 32;
+			if (out.size() < need) { out.resize(need + out.size() / 2); o = &out[0]; }
+		}
+		if (cp < 0x800) {
+			o[w++] = (char)(0xC0 | (cp >> 6));
+			o[w++] = (char)(0x80 | (cp & 0x3F));
+		}
+		else {
+			o[w++] = (char)(0xE0 | (cp >> 12));
+			o[w++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+			o[w++] = (char)(0x80 | (cp & 0x3F));
+		}
+	}
+	out.resize(w);
+	return out;
+}
+
+static inline std::string cp949ToUtf8(const std::string& s) { return cp949ToUtf8(s.data(), s.size()); }
@@ -0,0 +1,78 @@
+// TestBinTable.cpp : .bin 테이블 (BinTableWriter 로 쓰고 BinTable / LoadSchemaBin 으로 읽기)
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestItemUtil.h"
+#include "../CSVParser/BinTableWriter.h"
+#include "../TextRPG/BinTable.h"
+#include "../TextRPG/TableLoader.h"
+
+static void testBinRoundTrip() {
+	const std::vector<ItemBase> items = sampleItems(300);
+	std::vector<std::string> columns = { "Idx", "Name", "Type", "Value", "Effect" };
+	std::vector<ColumnSpec> types(5);
+	types[0].type = ColumnType::Int;
+	types[1].type = ColumnType::String;
+	types[2].type = ColumnType::String;
+	types[3].type = ColumnType::Int;
+	types[4].type = ColumnType::String;
+
+	BinTableWriter writer(columns, types);
+	for (const ItemBase& it : items) {
+		std::vector<std::string> row = { std::to_string(it.idx), it.name, it.type == IT_CONSUME ? "Consume" : "Etc",
+			std::to_string(it.value), it.effect };
+		writer.writeRow(row);
+	}
+	writer.writeRow(std::vector<std::string>{ "", "empty int", "Etc", "", "None" }); // 빈 정수 → null
+
+	std::filesystem::path path = std::filesystem::temp_directory_path() / "textrpg_tests_item.bin";
+	{
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		CHECK(writer.save(out));
+	}
+
+	BinTable table;
+	bool opened = table.Open(path.string());
+	CHECK(opened);
+	if (opened) {
+		CHECK_EQ(table.RowCount(), (uint64_t)items.size() + 1);
+		CHECK_EQ(table.ColumnCount(), (uint32_t)5);
+		int name = table.FindColumn("Name");
+		int value = table.FindColumn("Value");
+		CHECK_EQ(name, 1);
+		CHECK(table.ColumnType(value) == BCT_INT);
+		CHECK_EQ(table.FindColumn("Missing"), -1);
+		CHECK_EQ(table.GetString(name, 2), items[2].name);
+		CHECK_EQ(table.GetInt(value, 5), (int64_t)items[5].value);
+		CHECK(!table.IsNull(value, 5));
+		CHECK(table.IsNull(value, items.size()));
+
+		std::vector<ItemBase> loaded;
+		LoadSchemaBin<ItemSchema>(table, loaded);
+		CHECK_EQ(loaded.size(), items.size() + 1);
+		bool same = loaded.size() == items.size() + 1;
+		for (size_t r = 0; same && r < items.size(); ++r) same = sameItem(loaded[r], items[r]);
+		CHECK(same);
+		if (loaded.size() == items.size() + 1) {
+			CHECK_EQ(loaded.back().idx, 0);
+			CHECK_EQ(loaded.back().name, "empty int");
+		}
+	}
+	table.Close();
+
+	// 손상된 파일은 Open 에서 거절
+	{
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out << "not a table";
+	}
+	CHECK(!table.Open(path.string()));
+	std::error_code ec;
+	std::filesystem::remove(path, ec);
+}
+
+void runBinTableTests() {
+	testBinRoundTrip();
+}
@@ -0,0 +1,83 @@
+// TestCliUtil.h : CSVParser 실행 파일을 그대로 돌려 보는 테스트 도우미
+// 스트리밍 재시도, 매니페스트처럼 Main.cpp 안에만 있는 경로는 명령줄로 확인한다.
+// CSVPARSER_EXE 는 CMakeLists.txt 가 csvparser 타깃 경로로 넣어 준다.
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// 테스트 하나가 쓰는 임시 폴더. 만들 때 비우고, 끝나면 지운다.
+class TestDir {
+public:
+	explicit TestDir(const std::string& name) : root(std::filesystem::temp_directory_path() / ("textrpg_tests_" + name)) {
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+		std::filesystem::create_directories(root / "in");
+	}
+	~TestDir() {
+		std::error_code ec;
+		std::filesystem::remove_all(root, ec);
+	}
+	TestDir(const TestDir&) = delete;
+	TestDir& operator=(const TestDir&) = delete;
+
+	std::filesystem::path in() const { return root / "in"; }
+	std::filesystem::path path(const std::string& name) const { return root / name; }
+
+private:
+	std::filesystem::path root;
+};
+
+inline void writeTestFile(const std::filesystem::path& p, const std::string& data) {
+	std::ofstream out(p, std::ios::binary | std::ios::trunc);
+	out.write(data.data(), (std::streamsize)data.size());
+}
+
+inline std::string readTestFile(const std::filesystem::path& p) {
+	std::ifstream in(p, std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+struct CliResult {
+	int code = -1;
+	std::string out; // stdout (--stats=json)
+	std::string err; // stderr (변환 로그)
+};
+
+// csvparser <args...> 를 실행한다. 인자는 각각 따옴표로 감싼다.
+inline CliResult runCsvParser(const TestDir& dir, const std::vector<std::string>& args) {
+	std::filesystem::path outFile = dir.path("stdout.txt"), errFile = dir.path("stderr.txt");
+	std::string cmd = "\"" CSVPARSER_EXE "\"";
+	for (const std::string& a : args) cmd += " \"" + a + "\"";
+	cmd += " > \"" + outFile.string() + "\" 2> \"" + errFile.string() + "\"";
+#ifdef _WIN32
+	cmd = "\"" + cmd + "\""; // cmd /c 가 바깥 따옴표를 벗긴다
+#endif
+	CliResult r;
+	r.code = std::system(cmd.c_str());
+	r.out = readTestFile(outFile);
+	r.err = readTestFile(errFile);
+	return r;
+}
+
+// --stats=json 에서 "<phase>":{... "<key>":N ...} 의 N (없으면 UINT64_MAX)
+inline uint64_t statsValue(const std::string& json, const std::string& phase, const std::string& key) {
+	size_t at = json.find("\"" + phase + "\":{");
+	if (at == std::string::npos) return UINT64_MAX;
+	size_t end = json.find('}', at);
+	size_t k = json.find("\"" + key + "\":", at);
+	if (k == std::string::npos || k > end) return UINT64_MAX;
+	return std::strtoull(json.c_str() + k + key.size() + 3, nullptr, 10);
+}
+
+// --stats=json 에서 첫 시트의 "status"
+inline std::string statsStatus(const std::string& json) {
+	size_t at = json.find("\"status\":\"");
+	if (at == std::string::npos) return std::string();
+	at += 10;
+	return json.substr(at, json.find('"', at) - at);
+}
@@ -0,0 +1,97 @@
+// TestColumnTypes.cpp : ColumnTypeInfer / resolveColumnSpecs (자동 타입 추론 우선순위 Bool > Int > Float > String)
+#include <string_view>
+#include <vector>
+
+#include "TestUtil.h"
+#include "../CSVParser/ColumnTypes.h"
+
+// 한 컬럼에 값들을 넣고 추론 결과를 돌려준다
+static ColumnType inferColumn(std::vector<std::string_view> values) {
+	ColumnTypeInfer infer(1);
+	for (std::string_view v : values) {
+		std::string_view row[1] = { v };
+		infer.add(row);
+	}
+	return infer.result(0);
+}
+
+static void testInferOrder() {
+	CHECK(inferColumn({ "true", "FALSE", "True" }) == ColumnType::Bool);
+	CHECK(inferColumn({ "1", "-2", "0" }) == ColumnType::Int);
+	CHECK(inferColumn({ "1", "2.5" }) == ColumnType::Float);
+	CHECK(inferColumn({ "1", "abc" }) == ColumnType::String);
+	CHECK(inferColumn({ "true", "1" }) == ColumnType::String);
+	CHECK(inferColumn({ "1.5", "true" }) == ColumnType::String);
+}
+
+// 빈 칸은 추론에 영향이 없고, 전부 비었으면 String
+static void testInferEmpty() {
+	CHECK(inferColumn({ "", "3", "" }) == ColumnType::Int);
+	CHECK(inferColumn({ "", "true" }) == ColumnType::Bool);
+	CHECK(inferColumn({ "", "" }) == ColumnType::String);
+	CHECK(inferColumn({}) == ColumnType::String);
+}
+
+// JSON 숫자 문법 경계: -0, 앞의 +, 지수, 앞자리 0, int64 범위
+static void testInferLiterals() {
+	CHECK(inferColumn({ "-0" }) == ColumnType::Int);
+	CHECK(inferColumn({ "+1" }) == ColumnType::String);
+	CHECK(inferColumn({ "+1.5" }) == ColumnType::String);
+	CHECK(inferColumn({ "007" }) == ColumnType::String);
+	CHECK(inferColumn({ "1e3" }) == ColumnType::Float);
+	CHECK(inferColumn({ "-2.5E-3" }) == ColumnType::Float);
+	CHECK(inferColumn({ "1e" }) == ColumnType::String);
+	CHECK(inferColumn({ ".5" }) == ColumnType::String);
+	CHECK(inferColumn({ "9223372036854775807", "-9223372036854775808" }) == ColumnType::Int);
+	CHECK(inferColumn({ "9223372036854775808" }) == ColumnType::String);
+	CHECK(inferColumn({ "1", "-9223372036854775809" }) == ColumnType::String);
+	CHECK(inferColumn({ "1.5", "12345678901234567890" }) == ColumnType::String);
+}
+
+// 컬럼마다 따로 추론된다
+static void testInferColumns() {
+	ColumnTypeInfer infer(3);
+	std::string_view a[3] = { "1", "true", "x" };
+	std::string_view b[3] = { "2.5", "", "7" };
+	infer.add(a);
+	infer.add(b);
+	CHECK(infer.result(0) == ColumnType::Float);
+	CHECK(infer.result(1) == ColumnType::Bool);
+	CHECK(infer.result(2) == ColumnType::String);
+}
+
+// 명시한 타입은 그대로, Auto 와 specs 밖 컬럼은 infer 결과(없으면 String)
+static void testResolve() {
+	ColumnTypeInfer infer(3);
+	std::string_view row[3] = { "1", "2", "true" };
+	infer.add(row);
+
+	std::vector<ColumnSpec> specs(2);
+	CHECK(parseColumnSpec("float", specs[0]));
+	CHECK(parseColumnSpec("auto", specs[1]));
+
+	std::vector<ColumnSpec> out = resolveColumnSpecs(3, specs, &infer);
+	CHECK_EQ(out.size(), size_t(3));
+	CHECK(out[0].type == ColumnType::Float);
+	CHECK(out[1].type == ColumnType::Int);
+	CHECK(out[2].type == ColumnType::Bool);
+
+	out = resolveColumnSpecs(3, specs, nullptr);
+	CHECK(out[0].type == ColumnType::Float);
+	CHECK(out[1].type == ColumnType::String);
+	CHECK(out[2].type == ColumnType::String);
+
+	ColumnSpec e;
+	CHECK(parseColumnSpec("enum:A|B", e));
+	out = resolveColumnSpecs(1, { e }, &infer);
+	CHECK(out[0].type == ColumnType::Enum);
+	CHECK_EQ(out[0].enumValues.size(), size_t(2));
+}
+
+void runColumnTypesTests() {
+	testInferOrder();
+	testInferEmpty();
+	testInferLiterals();
+	testInferColumns();
+	testResolve();
+}
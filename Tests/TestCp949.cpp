@@ -0,0 +1,27 @@
+// TestCp949.cpp : cp949ToUtf8 (내장 CP949/UHC 표)
+#include <string>
+
+#include "TestUtil.h"
+#include "../CSVParser/TextEncoding.h"
+
+static void testCp949() {
+	CHECK_EQ(cp949ToUtf8(std::string("abc 123")), "abc 123");
+	CHECK_EQ(cp949ToUtf8(std::string("\xB0\xA1")), "\xEA\xB0\x80");  // 가 (KS X 1001)
+	CHECK_EQ(cp949ToUtf8(std::string("\xC6\x52")), "\xED\x9E\xA3");  // 힣 (UHC 확장)
+	CHECK_EQ(cp949ToUtf8(std::string("\x81\x41")), "\xEA\xB0\x82");  // 갂 (UHC 확장 첫 글자)
+	CHECK_EQ(cp949ToUtf8(std::string("\xCA\xA1")), "\xE4\xBC\xBD");  // 伽 (한자)
+	CHECK_EQ(cp949ToUtf8(std::string("\xA8\xE7")), "\xE2\x91\xA0");  // ① (특수 문자)
+	CHECK_EQ(cp949ToUtf8(std::string("\xA4\xA1")), "\xE3\x84\xB1");  // ㄱ (자모)
+
+	// ASCII 블록 사이에 섞인 한글
+	std::string ascii(40, 'x');
+	CHECK_EQ(cp949ToUtf8(ascii + "\xB0\xA1" + ascii), ascii + "\xEA\xB0\x80" + ascii);
+
+	// 짝이 없는 리드 바이트는 U+FFFD
+	CHECK_EQ(cp949ToUtf8(std::string("a\xB0")), "a\xEF\xBF\xBD");
+	CHECK_EQ(cp949ToUtf8(std::string("\xFF" "b")), "\xEF\xBF\xBD" "b");
+}
+
+void runCp949Tests() {
+	testCp949();
+}
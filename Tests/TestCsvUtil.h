@@ -0,0 +1,31 @@
+// TestCsvUtil.h : CSVParser 테스트 공용 도우미
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../CSVParser/CsvTokenizer.h"
+
+// 행마다 "[필드][필드]\n" 으로 이어 붙인다 (필드 안의 개행/쉼표도 괄호로 구분된다)
+inline void appendRow(std::string& out, const std::vector<std::string_view>& fields) {
+	for (std::string_view f : fields) {
+		out += '[';
+		out += f;
+		out += ']';
+	}
+	out += '\n';
+}
+
+inline std::string tokenizeAll(const std::string& csv) {
+	std::string out;
+	CsvTokenizer tok;
+	tok.tokenize(csv.data(), csv.size(), true, [&](const std::vector<std::string_view>& f) { appendRow(out, f); });
+	return out;
+}
+
+inline std::string tokenizeAllInPlace(std::string csv) {
+	std::string out;
+	CsvTokenizer tok;
+	tok.tokenizeInPlace(&csv[0], csv.size(), true, [&](const std::vector<std::string_view>& f) { appendRow(out, f); });
+	return out;
+}
@@ -0,0 +1,140 @@
+// TestItemIndex.cpp : Idx → 행 인덱스 (IdIndex 의 직접 매핑/open addressing, ItemManager::FindItem)
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "../TextRPG/ItemManager.h"
+#include "../TextRPG/ItemStore.h"
+
+// 기준 구현: 처음 나오는 행, 없으면 -1
+static int32_t linearFind(const std::vector<int>& ids, int idx) {
+	for (size_t r = 0; r < ids.size(); ++r)
+		if (ids[r] == idx) return (int32_t)r;
+	return -1;
+}
+
+// 있는 Idx 와 그 이웃(±1), 끝값 바깥을 전부 조회해 본다
+static std::vector<int> probes(const std::vector<int>& ids) {
+	std::vector<int> out = { 0, -1, 1, INT_MIN, INT_MAX };
+	for (int id : ids) {
+		out.push_back(id);
+		if (id > INT_MIN) out.push_back(id - 1);
+		if (id < INT_MAX) out.push_back(id + 1);
+	}
+	return out;
+}
+
+static bool indexMatchesScan(const std::vector<int>& ids, bool expectDense) {
+	IdIndex index;
+	index.Build(ids);
+	bool ok = CHECK_EQ(index.IsDense(), expectDense);
+	for (int p : probes(ids)) {
+		if (index.Find(p) != linearFind(ids, p)) {
+			std::printf("    Idx %d: index %d, scan %d\n", p, index.Find(p), linearFind(ids, p));
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+static std::vector<int> denseIds() {
+	std::vector<int> ids;
+	for (int r = 0; r < 1000; ++r) ids.push_back(r * 37 % 1000 + 1); // 1..1000 섞은 순서
+	return ids;
+}
+
+static std::vector<int> sparseIds() {
+	std::vector<int> ids;
+	for (int r = 0; r < 1000; ++r) ids.push_back(r * 7919 + 13);
+	return ids;
+}
+
+// 음수, 끝값, 해시 버킷이 겹치기 쉬운 2의 거듭제곱 간격
+static std::vector<int> negativeIds() {
+	std::vector<int> ids = { INT_MIN, INT_MAX, 0, -1 };
+	for (int r = 1; r < 500; ++r) {
+		ids.push_back(-r * 1000003);
+		ids.push_back(r << 16);
+	}
+	return ids;
+}
+
+static void testIdIndex() {
+	CHECK(indexMatchesScan(denseIds(), true));
+	CHECK(indexMatchesScan(sparseIds(), false));
+	CHECK(indexMatchesScan(negativeIds(), false));
+
+	// 음수여도 촘촘하면 직접 매핑 (빈 칸은 -1)
+	std::vector<int> negDense;
+	for (int r = -300; r <= 300; ++r)
+		if (r % 7) negDense.push_back(-r);
+	CHECK(indexMatchesScan(negDense, true));
+
+	// 같은 Idx 가 여러 번이면 처음 행
+	CHECK(indexMatchesScan({ 5, 9, 5, 9, 2 }, true));
+	CHECK(indexMatchesScan({ 5, 900000, 5, -900000, 900000 }, false));
+
+	IdIndex empty;
+	empty.Build({});
+	CHECK_EQ(empty.Find(0), -1);
+	IdIndex one;
+	one.Build({ 42 });
+	CHECK_EQ(one.Find(42), 0);
+	CHECK_EQ(one.Find(41), -1);
+}
+
+static std::shared_ptr<const ItemTable> makeTable(const std::vector<int>& ids) {
+	auto table = std::make_shared<ItemTable>(ids.size());
+	for (size_t r = 0; r < ids.size(); ++r) {
+		(*table)[r].idx = ids[r];
+		(*table)[r].name = "item " + std::to_string(r);
+		(*table)[r].value = (int)r;
+	}
+	return table;
+}
+
+static bool managerMatchesScan(const ItemManager& items, const std::vector<int>& ids) {
+	bool ok = true;
+	for (int p : probes(ids)) {
+		int32_t row = linearFind(ids, p);
+		std::optional<ItemRef> found = items.FindItem(p);
+		ok = ok && items.FindItemRow(p) == row && found.has_value() == (row >= 0);
+		if (found && row >= 0) ok = ok && found->idx == p && found->name == "item " + std::to_string(row);
+	}
+	return ok;
+}
+
+static void testFindItem() {
+	ItemManager items;
+	CHECK_EQ(items.GetVersion(), (uint64_t)0);
+	CHECK(!items.FindItem(1));
+
+	std::shared_ptr<const ItemTable> dense = makeTable(denseIds());
+	CHECK(items.Refresh(dense));
+	CHECK_EQ(items.GetVersion(), (uint64_t)1);
+	CHECK(managerMatchesScan(items, denseIds()));
+
+	// 같은 스냅샷이면 다시 만들지 않는다
+	CHECK(!items.Refresh(dense));
+	CHECK(!items.Refresh(nullptr));
+	CHECK_EQ(items.GetVersion(), (uint64_t)1);
+
+	CHECK(items.Refresh(makeTable(sparseIds())));
+	CHECK_EQ(items.GetVersion(), (uint64_t)2);
+	CHECK(managerMatchesScan(items, sparseIds()));
+
+	CHECK(items.Refresh(makeTable(negativeIds())));
+	CHECK_EQ(items.GetVersion(), (uint64_t)3);
+	CHECK(managerMatchesScan(items, negativeIds()));
+	CHECK_EQ(items.GetItemCount(), negativeIds().size());
+}
+
+void runItemIndexTests() {
+	testIdIndex();
+	testFindItem();
+}
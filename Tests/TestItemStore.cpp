@@ -0,0 +1,75 @@
+// TestItemStore.cpp : 컬럼 저장소 (StringPool 인터닝, ItemStore 행 ↔ 컬럼)
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestItemUtil.h"
+#include "../TextRPG/ItemStore.h"
+
+static void testStringPool() {
+	StringPool pool;
+	uint32_t heal = pool.Intern("Heal");
+	uint32_t mana = pool.Intern("Mana");
+	CHECK(heal != mana);
+	CHECK_EQ(pool.Intern(std::string("Heal")), heal); // 같은 문자열은 같은 ID
+	CHECK_EQ(pool.Intern(""), pool.Intern(std::string_view()));
+	CHECK_EQ(pool.Size(), (size_t)3);
+
+	// 나중에 많이 넣어도 먼저 받은 view 는 그대로 (같은 주소, 같은 내용)
+	std::string_view view = pool.Get(heal);
+	const char* at = view.data();
+	for (int k = 0; k < 20000; ++k) pool.Intern("name " + std::to_string(k));
+	CHECK(pool.Get(heal).data() == at);
+	CHECK_EQ(view, "Heal");
+	CHECK_EQ(pool.Intern("name 123"), pool.Intern("name 123"));
+	CHECK_EQ(pool.Get(pool.Intern("name 123")), "name 123");
+
+	// 이동해도 문자열 블록이 그대로 넘어가서 view 와 ID 가 유효
+	StringPool moved(std::move(pool));
+	CHECK(moved.Get(heal).data() == at);
+	CHECK_EQ(moved.Intern("Heal"), heal);
+	CHECK_EQ(moved.Intern("Mana"), mana);
+
+	moved.Clear();
+	CHECK_EQ(moved.Size(), (size_t)0);
+	CHECK_EQ(moved.Intern("Mana"), (uint32_t)0);
+}
+
+static void testItemStore() {
+	const std::vector<ItemBase> items = sampleItems(500);
+	ItemStore store;
+	store.Reserve(items.size());
+	for (const ItemBase& it : items) store.Add(it);
+	CHECK_EQ(store.Size(), items.size());
+
+	bool same = true;
+	size_t row = 0;
+	for (ItemRef ref : store) {
+		const ItemBase& it = items[row];
+		same = same && ref.idx == it.idx && ref.type == it.type && ref.name == it.name && ref.effect == it.effect &&
+			ref.value == it.value && store.IdxColumn()[row] == it.idx && store.TypeColumn()[row] == it.type &&
+			store.ValueColumn()[row] == it.value;
+		++row;
+	}
+	CHECK(same);
+	CHECK_EQ(row, items.size());
+
+	// 반복되는 effect 는 한 번만 저장 → 같은 주소
+	CHECK(store.At(0).effect.data() == store.At(3).effect.data());
+
+	// 이동한 저장소의 ItemRef 도 원래 문자열을 가리킨다
+	std::string_view name = store.At(7).name;
+	ItemStore moved(std::move(store));
+	CHECK(moved.At(7).name.data() == name.data());
+	CHECK_EQ(moved.At(7).name, items[7].name);
+
+	moved.Clear();
+	CHECK_EQ(moved.Size(), (size_t)0);
+}
+
+void runItemStoreTests() {
+	testStringPool();
+	testItemStore();
+}
@@ -0,0 +1,24 @@
+// TestItemUtil.h : TextRPG 테스트 공용 아이템 표본
+#pragma once
+#include <string>
+#include <vector>
+
+#include "../TextRPG/TableSchemas.h"
+
+inline bool sameItem(const ItemBase& a, const ItemBase& b) {
+	return a.idx == b.idx && a.type == b.type && a.name == b.name && a.effect == b.effect && a.value == b.value;
+}
+
+inline std::vector<ItemBase> sampleItems(size_t rows) {
+	static const char* const names[] = { "회복포션", "a, b", "multi\nline", "say \"hi\"", "", "\xF0\x9F\x98\x80" };
+	static const char* const effects[] = { "Heal", "Mana", "None" };
+	std::vector<ItemBase> items(rows);
+	for (size_t r = 0; r < rows; ++r) {
+		items[r].idx = (int)r + 1;
+		items[r].type = (r % 2) ? IT_CONSUME : IT_NONE;
+		items[r].name = std::string(names[r % 6]) + (r % 6 == 4 ? "" : std::to_string(r));
+		items[r].effect = effects[r % 3];
+		items[r].value = (int)(r * 37 % 1000) - 100;
+	}
+	return items;
+}
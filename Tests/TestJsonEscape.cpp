@@ -0,0 +1,91 @@
+// TestJsonEscape.cpp : jsonFindEscape / appendJsonEscaped (SIMD 경로와 바이트 단위 기준 구현 비교)
+// 기본 빌드는 SSE2 경로, -DTESTS_NATIVE=ON 이면 (지원하는 CPU 에서) AVX2 경로를 확인한다.
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "TestUtil.h"
+#include "../CSVParser/JsonWriter.h"
+
+static bool needsEscape(unsigned char c) {
+	return c < 0x20 || c == '"' || c == '\\';
+}
+
+static size_t scalarFindEscape(const std::string& s, size_t i) {
+	while (i < s.size() && !needsEscape((unsigned char)s[i])) ++i;
+	return i;
+}
+
+static std::string scalarEscape(const std::string& s) {
+	std::string out;
+	for (unsigned char c : s) {
+		switch (c) {
+		case '"': out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\b': out += "\\b"; break;
+		case '\f': out += "\\f"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			if (c < 0x20) {
+				char u[8];
+				std::snprintf(u, sizeof(u), "\\u%04x", c);
+				out += u;
+			}
+			else out += (char)c;
+		}
+	}
+	return out;
+}
+
+// 이스케이프가 필요 없는 바탕: ASCII, 한글 UTF-8, 0x80 이상 바이트(부호 있는 비교면 제어 문자로 오인), 경계값 0x20/0x7F
+static std::string background(int kind, size_t len) {
+	static const char* const fills[] = { "abcdefgh", "\xEA\xB0\x80\xED\x9E\xA3", "\x80\xBF\xC0\xFF\xFE\x9F", " \x7F~!" };
+	std::string_view f = fills[kind];
+	std::string s;
+	for (size_t i = 0; i < len; ++i) s += f[i % f.size()];
+	return s;
+}
+
+static void testFindAndEscape() {
+	const char specials[] = { '\0', '\x01', '\x1F', '"', '\\', '\n', '\t' };
+	size_t mismatches = 0, cases = 0;
+	auto check = [&](const std::string& s) {
+		++cases;
+		for (size_t start : { (size_t)0, (size_t)1, (size_t)5, (size_t)17, (size_t)33 }) {
+			if (start > s.size()) break;
+			if (jsonFindEscape(s.data(), start, s.size()) != scalarFindEscape(s, start)) ++mismatches;
+		}
+		std::string out = "pre";
+		appendJsonEscaped(out, s);
+		if (out != "pre" + scalarEscape(s)) ++mismatches;
+	};
+
+	for (int kind = 0; kind < 4; ++kind) {
+		for (size_t len = 0; len <= 80; ++len) {
+			const std::string base = background(kind, len);
+			check(base);
+			for (size_t pos = 0; pos < len; ++pos) {
+				for (char c : specials) {
+					std::string s = base;
+					s[pos] = c;
+					check(s);
+					s[len - 1] = '"'; // 하나 더 (블록 뒤쪽)
+					check(s);
+				}
+			}
+		}
+	}
+	CHECK_EQ(mismatches, (size_t)0);
+	CHECK(cases > 40000);
+
+	CHECK_EQ(scalarEscape(std::string("\x01\x1F", 2)), "\\u0001\\u001f");
+	std::string out;
+	appendJsonEscaped(out, std::string_view("a\0b", 3));
+	CHECK_EQ(out, "a\\u0000b");
+}
+
+void runJsonEscapeTests() {
+	testFindAndEscape();
+}
@@ -0,0 +1,41 @@
+// TestJsonParser.cpp : JsonParser 문자열 fast path (\u 이스케이프, 서로게이트 쌍) 와 SAX 로더
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "../TextRPG/JsonParser.h"
+#include "../TextRPG/TableLoader.h"
+#include "../TextRPG/TableSchemas.h"
+
+static std::string parseJsonString(const std::string& json) {
+	JsonParser p(json);
+	return p.parse().str;
+}
+
+static void testJsonUnicodeEscapes() {
+	CHECK_EQ(parseJsonString("\"\\u0041\""), "A");
+	CHECK_EQ(parseJsonString("\"\\u00e9\""), "\xC3\xA9");                   // é (2바이트)
+	CHECK_EQ(parseJsonString("\"\\uAC00\\uD7A3\""), "\xEA\xB0\x80\xED\x9E\xA3"); // 가힣 (3바이트)
+	CHECK_EQ(parseJsonString("\"\\ud83d\\ude00\""), "\xF0\x9F\x98\x80");     // 😀 서로게이트 쌍 (4바이트)
+	CHECK_EQ(parseJsonString("\"x\\uD83D\\uDE00y\""), "x\xF0\x9F\x98\x80y");
+
+	CHECK_THROWS(parseJsonString("\"\\ud83d\""));        // 짝 없는 high
+	CHECK_THROWS(parseJsonString("\"\\ude00\""));        // 짝 없는 low
+	CHECK_THROWS(parseJsonString("\"\\ud83d\\u0041\"")); // high 뒤가 low 가 아님
+	CHECK_THROWS(parseJsonString("\"\\ud83dx\""));
+	CHECK_THROWS(parseJsonString("\"\\u12\""));
+
+	// SAX 테이블 로더도 같은 규칙
+	std::vector<ItemBase> items;
+	LoadSchemaJson<ItemSchema>("[{\"Idx\":7,\"Name\":\"\\ud83d\\ude00\\uac00\",\"Type\":\"Consume\",\"Value\":3,\"Effect\":\"Heal\"}]", items);
+	CHECK_EQ(items.size(), (size_t)1);
+	if (items.size() == 1) {
+		CHECK_EQ(items[0].name, "\xF0\x9F\x98\x80\xEA\xB0\x80");
+		CHECK_EQ(items[0].idx, 7);
+		CHECK(items[0].type == IT_CONSUME);
+	}
+}
+
+void runJsonParserTests() {
+	testJsonUnicodeEscapes();
+}
@@ -0,0 +1,76 @@
+// TestJsonWriter.cpp : JsonTableWriter (JSON 배열 / NDJSON 한 줄에 객체 하나, 타입별 값)
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "../CSVParser/JsonWriter.h"
+#include "../TextRPG/JsonParser.h"
+
+static std::string writeTable(const std::vector<std::string>& columns, const std::vector<ColumnSpec>& types,
+	bool lines, const std::vector<std::vector<std::string>>& rows) {
+	JsonTableWriter w(columns, types, lines);
+	std::string out;
+	w.begin(out);
+	for (const auto& r : rows) w.writeRow(out, r);
+	w.end(out);
+	return out;
+}
+
+static ColumnSpec spec(ColumnType t) {
+	ColumnSpec s;
+	s.type = t;
+	return s;
+}
+
+static void testJsonArray() {
+	// 키는 컬럼명 사전순, 값은 모두 문자열
+	CHECK_EQ(writeTable({ "b", "a" }, {}, false, { { "1", "x" }, { "2", "y\"z" } }),
+		"[{\"a\":\"x\",\"b\":\"1\"},{\"a\":\"y\\\"z\",\"b\":\"2\"}]");
+	CHECK_EQ(writeTable({ "a" }, {}, false, {}), "[]");
+	// 같은 이름이 여러 번이면 마지막 컬럼
+	CHECK_EQ(writeTable({ "k", "k" }, {}, false, { { "first", "last" } }), "[{\"k\":\"last\"}]");
+
+	// 타입 컬럼: 숫자/불리언은 따옴표 없이, 빈 칸은 null
+	ColumnSpec level = spec(ColumnType::Enum);
+	level.enumValues = { "Low", "High" };
+	std::vector<ColumnSpec> types = { spec(ColumnType::Int), spec(ColumnType::Float), spec(ColumnType::Bool), level, spec(ColumnType::Auto) };
+	std::vector<std::string> cols = { "i", "f", "b", "e", "s" };
+	CHECK_EQ(writeTable(cols, types, false, { { "-3", "1.5e3", "TRUE", "High", "7" }, { "", "", "", "", "" } }),
+		"[{\"b\":true,\"e\":\"High\",\"f\":1.5e3,\"i\":-3,\"s\":\"7\"},{\"b\":null,\"e\":null,\"f\":null,\"i\":null,\"s\":\"\"}]");
+	CHECK_THROWS(writeTable(cols, types, false, { { "1.5", "1", "true", "Low", "" } }));
+	CHECK_THROWS(writeTable(cols, types, false, { { "1", "x", "true", "Low", "" } }));
+	CHECK_THROWS(writeTable(cols, types, false, { { "1", "1", "yes", "Low", "" } }));
+	CHECK_THROWS(writeTable(cols, types, false, { { "1", "1", "true", "Mid", "" } }));
+}
+
+// NDJSON: 배열 없이 줄마다 객체 하나. 값 안의 개행은 escape 되어 줄을 나누지 않는다.
+static void testNdjsonLines() {
+	std::vector<std::vector<std::string>> rows;
+	for (int r = 0; r < 50; ++r)
+		rows.push_back({ std::to_string(r), "line\nbreak " + std::to_string(r), "cr\r\ntab\t\"q\"\\" });
+	std::string out = writeTable({ "Idx", "Name", "Note" }, { spec(ColumnType::Int) }, true, rows);
+
+	std::vector<std::string> lines;
+	size_t start = 0;
+	for (size_t nl; (nl = out.find('\n', start)) != std::string::npos; start = nl + 1)
+		lines.push_back(out.substr(start, nl - start));
+	CHECK_EQ(start, out.size()); // 마지막 행도 개행으로 끝난다
+	CHECK_EQ(lines.size(), rows.size());
+	CHECK(out.find('\r') == std::string::npos);
+
+	bool same = lines.size() == rows.size();
+	for (size_t r = 0; same && r < lines.size(); ++r) {
+		JsonParser p(lines[r]);
+		JsonValue v = p.parse();
+		same = v.type == JsonValue::Object && v.getInt("Idx", -1) == (int)r && v.getString("Name") == rows[r][1] &&
+			v.getString("Note") == rows[r][2];
+	}
+	CHECK(same);
+	CHECK_EQ(writeTable({ "a" }, {}, true, {}), "");
+}
+
+void runJsonWriterTests() {
+	testJsonArray();
+	testNdjsonLines();
+}
@@ -0,0 +1,64 @@
+// TestLazyLoad.cpp : LoadMode::Lazy (처음 GetItems 를 여러 스레드가 동시에 불러도 한 번만 로드)
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestCliUtil.h"
+#include "../TextRPG/DataManager.h"
+
+static void testLazyLoadOnce() {
+	// DataManager 는 "../Resources/output" 을 읽으므로 in/ 을 현재 폴더로 삼는다
+	TestDir dir("lazy_load");
+	std::filesystem::create_directories(dir.path("Resources/output"));
+	const int rows = 20000;
+	std::string json = "[";
+	for (int r = 1; r <= rows; ++r) {
+		if (r > 1) json += ',';
+		json += "{\"Effect\":\"Heal\",\"Idx\":" + std::to_string(r) + ",\"Name\":\"item " + std::to_string(r) +
+			"\",\"Type\":\"Consume\",\"Value\":" + std::to_string(r % 100) + "}";
+	}
+	json += "]";
+	writeTestFile(dir.path("Resources/output/Item.json"), json);
+
+	std::filesystem::path cwd = std::filesystem::current_path();
+	std::filesystem::current_path(dir.in());
+
+	DataManager& dm = DataManager::Instance();
+	CHECK(dm.Initialize(LoadMode::Lazy));
+
+	const int threadCount = 8;
+	std::vector<std::shared_ptr<const ItemTable>> got(threadCount);
+	std::atomic<int> ready{ 0 };
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCount; ++t) {
+		threads.emplace_back([&, t]() {
+			++ready;
+			while (ready.load() < threadCount) std::this_thread::yield(); // 최대한 동시에 첫 GetItems
+			got[t] = dm.GetItems();
+		});
+	}
+	for (std::thread& th : threads) th.join();
+
+	// 로드가 두 번 일어났다면 서로 다른 스냅샷을 받은 스레드가 있다
+	bool same = got[0] != nullptr;
+	for (const auto& p : got) same = same && p == got[0];
+	CHECK(same);
+	if (got[0]) {
+		CHECK_EQ(got[0]->size(), (size_t)rows);
+		if (!got[0]->empty()) CHECK_EQ(got[0]->back().name, "item 20000");
+	}
+
+	// 로드한 뒤에는 파일을 다시 읽지 않는다
+	std::filesystem::remove(dir.path("Resources/output/Item.json"));
+	CHECK(dm.GetItems() == got[0]);
+
+	std::filesystem::current_path(cwd);
+}
+
+void runLazyLoadTests() {
+	testLazyLoadOnce();
+}
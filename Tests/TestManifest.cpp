@@ -0,0 +1,70 @@
+// TestManifest.cpp : 매니페스트로 바뀌지 않은 시트 건너뛰기 (명령줄)
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestCliUtil.h"
+
+static std::string convertStatus(const TestDir& dir, bool force = false) {
+	std::vector<std::string> args = { dir.in().string(), dir.path("out").string(), "--stats=json" };
+	if (force) args.push_back("--force");
+	CliResult r = runCsvParser(dir, args);
+	CHECK_EQ(r.code, 0);
+	return statsStatus(r.out);
+}
+
+static void testSkipIfUnchanged() {
+	TestDir dir("manifest_skip");
+	std::filesystem::path csv = dir.in() / "Item.csv";
+	std::filesystem::path json = dir.path("out") / "Item.json";
+	writeTestFile(csv, "Idx,Name,Type,Value,Effect\n1,Potion,Consume,10,Heal\n");
+	CHECK_EQ(convertStatus(dir), "ok");
+
+	// 크기/수정 시각이 그대로면 읽지 않고 건너뛴다
+	CHECK_EQ(convertStatus(dir), "uptodate");
+
+	// 수정 시각만 바뀌면 해시가 같으니 건너뛴다
+	std::filesystem::file_time_type mtime = std::filesystem::last_write_time(csv);
+	std::filesystem::last_write_time(csv, mtime + std::chrono::seconds(2));
+	CHECK_EQ(convertStatus(dir), "uptodate");
+
+	// 크기가 같아도 내용이 바뀌면 다시 변환
+	writeTestFile(csv, "Idx,Name,Type,Value,Effect\n1,Potion,Consume,20,Heal\n");
+	std::filesystem::last_write_time(csv, mtime + std::chrono::seconds(4));
+	CHECK_EQ(convertStatus(dir), "ok");
+	CHECK(readTestFile(json).find("\"Value\":20") != std::string::npos);
+	CHECK_EQ(convertStatus(dir), "uptodate");
+
+	// --force 는 매니페스트를 보지 않는다
+	CHECK_EQ(convertStatus(dir, true), "ok");
+
+	// 출력이 지워졌으면 다시 만든다
+	std::filesystem::remove(json);
+	CHECK_EQ(convertStatus(dir), "ok");
+	CHECK(std::filesystem::exists(json));
+}
+
+// 지워진 CSV 의 항목은 다음 저장 때 빠진다
+static void testPrune() {
+	TestDir dir("manifest_prune");
+	writeTestFile(dir.in() / "Item.csv", "Idx,Name,Type,Value,Effect\n1,Potion,Consume,10,Heal\n");
+	writeTestFile(dir.in() / "Shop.csv", "ShopId,ItemIdx,Price,Stock\n1,1,100,5\n");
+	convertStatus(dir);
+	std::filesystem::path manifest = dir.path("out") / ".csvparser-manifest";
+	std::string before = readTestFile(manifest);
+	CHECK(before.find("\nItem\t") != std::string::npos);
+	CHECK(before.find("\nShop\t") != std::string::npos);
+
+	std::filesystem::remove(dir.in() / "Shop.csv");
+	CHECK_EQ(convertStatus(dir), "uptodate");
+	std::string after = readTestFile(manifest);
+	CHECK(after.find("\nItem\t") != std::string::npos);
+	CHECK(after.find("\nShop\t") == std::string::npos);
+}
+
+void runManifestTests() {
+	testSkipIfUnchanged();
+	testPrune();
+}
@@ -0,0 +1,50 @@
+// TestNdjson.cpp : LoadSchemaNdjson (줄 단위 분할 병렬 로드)
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestItemUtil.h"
+#include "../TextRPG/TableLoader.h"
+
+// {"Idx":1,...}\n 를 이어 붙인 NDJSON (JSON 문자열 안의 개행은 \n 으로 escape)
+static std::string toNdjson(const std::vector<ItemBase>& items) {
+	std::string out;
+	for (const ItemBase& it : items) {
+		out += "{\"Effect\":\"" + it.effect + "\",\"Idx\":" + std::to_string(it.idx) + ",\"Name\":\"";
+		for (char c : it.name) {
+			if (c == '\n') out += "\\n";
+			else if (c == '"') out += "\\\"";
+			else out += c;
+		}
+		out += "\",\"Type\":\"";
+		out += it.type == IT_CONSUME ? "Consume" : "Etc";
+		out += "\",\"Value\":" + std::to_string(it.value) + "}\n";
+	}
+	return out;
+}
+
+static void testNdjsonSplit() {
+	// 분할은 구간마다 SchemaNdjsonMinPartBytes 이상일 때만 일어나므로 넉넉히 만든다
+	const std::vector<ItemBase> items = sampleItems(60000);
+	std::string text = "\xEF\xBB\xBF" + toNdjson(items) + "\n";
+	CHECK(text.size() > SchemaNdjsonMinPartBytes * 3);
+
+	for (unsigned threads : { 1u, 2u, 3u, 7u }) {
+		std::vector<ItemBase> loaded;
+		LoadSchemaNdjson<ItemSchema>(text, loaded, threads);
+		bool same = loaded.size() == items.size();
+		for (size_t r = 0; same && r < items.size(); ++r) same = sameItem(loaded[r], items[r]);
+		CHECK(same);
+	}
+
+	// 빈 줄/CRLF 는 건너뛰고, 깨진 줄은 예외
+	std::vector<ItemBase> small;
+	LoadSchemaNdjson<ItemSchema>("{\"Idx\":1,\"Name\":\"a\"}\r\n\r\n{\"Idx\":2,\"Name\":\"b\"}", small, 1);
+	CHECK_EQ(small.size(), (size_t)2);
+	if (small.size() == 2) CHECK_EQ(small[1].name, "b");
+	CHECK_THROWS(LoadSchemaNdjson<ItemSchema>("{\"Idx\":1}\n{\"Idx\":\n", small, 1));
+}
+
+void runNdjsonTests() {
+	testNdjsonSplit();
+}
@@ -0,0 +1,109 @@
+// TestShop.cpp : ShopManager (ShopId 구간, ItemIdx 역인덱스, 아이템 조인)
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "../TextRPG/ItemManager.h"
+#include "../TextRPG/ShopManager.h"
+
+static std::shared_ptr<const ItemTable> makeItems(const std::string& prefix) {
+	auto items = std::make_shared<ItemTable>();
+	for (int idx : { 1, 2, 3, 50, 70000 }) {
+		ItemBase it;
+		it.idx = idx;
+		it.name = prefix + std::to_string(idx);
+		items->push_back(it);
+	}
+	return items;
+}
+
+// 파일 순서. ShopId 는 섞여 있고 듬성한 것도 있으며, 999/-5 는 없는 아이템이다.
+static std::shared_ptr<const ShopTable> makeShops() {
+	const int rows[][4] = {
+		{ 3, 1, 100, 5 }, { 1, 2, 200, 1 }, { 3, 999, 300, 0 }, { 2, 3, 50, 9 }, { 1, 1, 110, 2 },
+		{ 1000000, 70000, 7, 7 }, { 3, 2, 210, 4 }, { 1, -5, 1, 1 }, { 2, 1, 120, 3 },
+	};
+	auto shops = std::make_shared<ShopTable>();
+	for (const auto& r : rows) {
+		ShopBase s;
+		s.shopId = r[0];
+		s.itemIdx = r[1];
+		s.price = r[2];
+		s.stock = r[3];
+		shops->push_back(s);
+	}
+	return shops;
+}
+
+static bool sameRow(const ShopEntry& e, const ShopBase& s) {
+	return e.shopId == s.shopId && e.itemIdx == s.itemIdx && e.price == s.price && e.stock == s.stock;
+}
+
+// 상점마다 파일 순서 그대로, 조인은 FindItemRow 와 같아야 한다
+static bool shopsMatchScan(const ShopManager& shops, const ShopTable& source, const ItemManager& items) {
+	bool ok = true;
+	for (int shopId : { 1, 2, 3, 4, 0, -1, 1000000, 999999 }) {
+		std::vector<const ShopBase*> expected;
+		for (const ShopBase& s : source)
+			if (s.shopId == shopId) expected.push_back(&s);
+		ShopSpan<ShopEntry> span = shops.GetShop(shopId);
+		ok = ok && span.size() == expected.size();
+		size_t k = 0;
+		for (const ShopEntry& e : span) {
+			if (k >= expected.size()) break;
+			ok = ok && sameRow(e, *expected[k++]) && e.itemRow == items.FindItemRow(e.itemIdx);
+			if (e.itemRow >= 0) ok = ok && e.item.name == items.GetItem((size_t)e.itemRow).name;
+		}
+	}
+	return ok;
+}
+
+// ItemIdx 로 찾은 항목 번호들 = 그 아이템을 가진 항목 전부 (없는 아이템도 포함)
+static bool byItemMatchesScan(const ShopManager& shops, const ShopTable& source) {
+	bool ok = true;
+	for (int itemIdx : { 1, 2, 3, 50, 70000, 999, -5, 4, 0 }) {
+		size_t expected = 0;
+		for (const ShopBase& s : source)
+			if (s.itemIdx == itemIdx) ++expected;
+		ShopSpan<uint32_t> span = shops.FindEntriesByItem(itemIdx);
+		ok = ok && span.size() == expected;
+		for (uint32_t e : span) ok = ok && shops.GetEntry(e).itemIdx == itemIdx;
+	}
+	return ok;
+}
+
+static void testShopIndex() {
+	ItemManager items;
+	items.Refresh(makeItems("a"));
+	std::shared_ptr<const ShopTable> source = makeShops();
+	ShopManager shops;
+	CHECK(shops.GetShop(1).empty());
+	CHECK(shops.Refresh(source, items));
+	CHECK(shopsMatchScan(shops, *source, items));
+	CHECK(byItemMatchesScan(shops, *source));
+
+	// 없는 아이템을 파는 항목은 itemRow = -1
+	ShopSpan<uint32_t> missing = shops.FindEntriesByItem(999);
+	CHECK_EQ(missing.size(), (size_t)1);
+	if (missing.size() == 1) {
+		const ShopEntry& e = shops.GetEntry(*missing.begin());
+		CHECK_EQ(e.shopId, 3);
+		CHECK_EQ(e.itemRow, -1);
+	}
+	CHECK_EQ(shops.GetShop(1000000).size(), (size_t)1);
+	if (!shops.GetShop(1000000).empty()) CHECK_EQ(shops.GetShop(1000000).begin()->item.name, "a70000");
+
+	// 스냅샷과 아이템 버전이 그대로면 다시 만들지 않는다
+	CHECK(!shops.Refresh(source, items));
+
+	// 아이템만 다시 만들어져도(ItemRef 무효) 다시 조인
+	items.Refresh(makeItems("b"));
+	CHECK(shops.Refresh(source, items));
+	CHECK(shopsMatchScan(shops, *source, items));
+	if (!shops.GetShop(2).empty()) CHECK_EQ(shops.GetShop(2).begin()->item.name, "b3");
+}
+
+void runShopTests() {
+	testShopIndex();
+}
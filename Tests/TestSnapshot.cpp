@@ -0,0 +1,75 @@
+// TestSnapshot.cpp : SnapshotSlot (읽는 스레드 여럿 + 바꿔 끼우는 스레드 하나)
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "TestUtil.h"
+#include "../TextRPG/Snapshot.h"
+
+// 버전 k 스냅샷: 길이 k % 64 + 1, 원소는 전부 k
+static std::shared_ptr<const std::vector<int>> makeVersion(int k) {
+	return std::make_shared<const std::vector<int>>((size_t)(k % 64 + 1), k);
+}
+
+static bool wholeVersion(const std::vector<int>& v) {
+	if (v.empty() || v.size() != (size_t)(v.front() % 64 + 1)) return false;
+	for (int x : v)
+		if (x != v.front()) return false;
+	return true;
+}
+
+static void testConcurrentStore() {
+	const int versions = 20000;
+	SnapshotSlot<std::vector<int>> slot;
+	CHECK(slot.Load() == nullptr);
+	slot.Store(makeVersion(0));
+
+	std::atomic<bool> done{ false };
+	std::atomic<int> broken{ 0 }, backwards{ 0 };
+	std::atomic<long long> loads{ 0 };
+	auto reader = [&](std::vector<std::shared_ptr<const std::vector<int>>>& kept) {
+		int last = -1;
+		long long n = 0;
+		while (!done.load()) {
+			std::shared_ptr<const std::vector<int>> s = slot.Load();
+			++n;
+			if (!s || !wholeVersion(*s)) { ++broken; continue; }
+			if (s->front() < last) ++backwards; // 한 스레드가 보는 버전은 되돌아가지 않는다
+			last = s->front();
+			if (n % 97 == 0) kept.push_back(std::move(s)); // 교체된 뒤에도 들고 있을 스냅샷
+		}
+		loads += n;
+	};
+
+	const int readerCount = 4;
+	std::vector<std::vector<std::shared_ptr<const std::vector<int>>>> kept(readerCount);
+	std::vector<std::thread> readers;
+	for (int r = 0; r < readerCount; ++r) readers.emplace_back(reader, std::ref(kept[r]));
+	for (int k = 1; k <= versions; ++k) slot.Store(makeVersion(k));
+	done = true;
+	for (std::thread& th : readers) th.join();
+
+	CHECK_EQ(broken.load(), 0);
+	CHECK_EQ(backwards.load(), 0);
+	CHECK(loads.load() > 0);
+	CHECK_EQ(slot.Load()->front(), versions);
+
+	// 예전 스냅샷은 슬롯이 여러 번 바뀐 뒤에도 그대로
+	bool intact = true;
+	size_t count = 0;
+	for (const auto& list : kept)
+		for (const auto& s : list) {
+			intact = intact && wholeVersion(*s);
+			++count;
+		}
+	CHECK(intact);
+	std::printf("  %lld loads, %zu kept snapshots\n", loads.load(), count);
+}
+
+void runSnapshotTests() {
+	testConcurrentStore();
+}
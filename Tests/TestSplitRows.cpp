@@ -0,0 +1,31 @@
+// TestSplitRows.cpp : csvSplitRows (큰 시트를 행 경계에서 나눠 여러 스레드로 토큰화)
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestCsvUtil.h"
+
+// 나눈 구간을 따로 토큰화해서 이어 붙이면 통째로 토큰화한 것과 같아야 한다
+static void testSplitRows() {
+	std::string csv;
+	for (int r = 0; r < 400; ++r) {
+		csv += std::to_string(r);
+		csv += (r % 3 == 0) ? ",\"quoted\nnew,line \"\"" + std::to_string(r) + "\"\"\"\n" : ",plain\n";
+	}
+	auto serial = [](unsigned n, auto&& fn) { for (unsigned k = 0; k < n; ++k) fn(k); };
+	const std::string whole = tokenizeAll(csv);
+	for (unsigned parts : { 2u, 3u, 7u, 16u }) {
+		std::vector<size_t> starts = csvSplitRows(csv.data(), csv.size(), parts, serial);
+		CHECK(starts.size() >= 2 && starts.front() == 0 && starts.back() == csv.size());
+		std::string joined;
+		for (size_t k = 0; k + 1 < starts.size(); ++k) {
+			CHECK(starts[k] == 0 || csv[starts[k] - 1] == '\n');
+			joined += tokenizeAll(csv.substr(starts[k], starts[k + 1] - starts[k]));
+		}
+		CHECK_EQ(joined, whole);
+	}
+}
+
+void runSplitRowsTests() {
+	testSplitRows();
+}
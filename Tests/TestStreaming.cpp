@@ -0,0 +1,95 @@
+// TestStreaming.cpp : --stream 변환 (통째로 읽은 결과와 같은지, CP949 로 다시 읽을 때 통계가 겹치지 않는지)
+// 와 --parse-jobs 병렬 파싱(중간에 끝나는 시트도 한 스레드 결과와 같은지)
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestCliUtil.h"
+
+// Item 시트 (Idx,Name,Type,Value,Effect). 앞쪽 asciiBytes 는 ASCII 만, 그 뒤 cp949Rows 행은 이름이 CP949 "가".
+static std::string makeItemCsv(size_t asciiBytes, size_t cp949Rows, size_t& dataRows) {
+	std::string csv = "Idx,Name,Type,Value,Effect\n";
+	dataRows = 0;
+	while (csv.size() < asciiBytes) {
+		++dataRows;
+		csv += std::to_string(dataRows) + ",Item name " + std::to_string(dataRows) + ",Consume," + std::to_string(dataRows * 3) + ",Heal\n";
+	}
+	for (size_t r = 0; r < cp949Rows; ++r) {
+		++dataRows;
+		csv += std::to_string(dataRows) + ",\xB0\xA1" + std::to_string(r) + ",Etc,1,None\n";
+	}
+	return csv;
+}
+
+static void checkStreamedMatchesWhole(const std::string& name, const std::string& csv, size_t dataRows) {
+	TestDir dir(name);
+	writeTestFile(dir.in() / "Item.csv", csv);
+	CliResult whole = runCsvParser(dir, { dir.in().string(), dir.path("whole").string() });
+	CliResult streamed = runCsvParser(dir, { dir.in().string(), dir.path("stream").string(), "--stream", "--parse-jobs", "1", "--stats=json" });
+	CHECK_EQ(whole.code, 0);
+	CHECK_EQ(streamed.code, 0);
+	std::string expected = readTestFile(dir.path("whole") / "Item.json");
+	CHECK(!expected.empty());
+	CHECK(readTestFile(dir.path("stream") / "Item.json") == expected);
+
+	// 파일은 값 단계마다 한 번씩만 읽는다(타입 추론이 있으면 두 번). 버린 시도의 바이트/행은 없어야 한다.
+	const std::string& json = streamed.out;
+	CHECK_EQ(statsStatus(json), "ok");
+	uint64_t passes = statsValue(json, "infer", "rows") > 0 ? 2 : 1;
+	CHECK_EQ(statsValue(json, "read", "bytes"), passes * csv.size());
+	CHECK_EQ(statsValue(json, "serialize", "rows"), (uint64_t)dataRows);
+	CHECK_EQ(statsValue(json, "slice", "rows"), (uint64_t)dataRows);
+}
+
+static void testStreamUtf8() {
+	size_t dataRows = 0;
+	std::string csv = makeItemCsv(1500000, 0, dataRows);
+	checkStreamedMatchesWhole("stream_utf8", csv, dataRows);
+}
+
+// 첫 1MB 청크는 ASCII 라 UTF-8 로 시작했다가 뒤 청크에서 CP949 를 만나 처음부터 다시 읽는 경우
+static void testStreamCp949Retry() {
+	size_t dataRows = 0;
+	std::string csv = makeItemCsv(1500000, 500, dataRows);
+	checkStreamedMatchesWhole("stream_cp949", csv, dataRows);
+
+	TestDir dir("stream_cp949_text");
+	writeTestFile(dir.in() / "Item.csv", csv);
+	CHECK_EQ(runCsvParser(dir, { dir.in().string(), dir.path("out").string(), "--stream" }).code, 0);
+	CHECK(readTestFile(dir.path("out") / "Item.json").find("\xEA\xB0\x80" "499") != std::string::npos); // 가499
+}
+
+// 첫 컬럼이 빈 행에서 시트가 끝난다. 병렬로 자르면 그 뒤 구간들은 일찍 그만두지만 결과는 한 스레드와 같아야 한다.
+static void testParallelStopRow() {
+	const size_t stopRow = 90000;
+	std::string csv = "Idx,Name,Type,Value,Effect\n";
+	for (size_t r = 1; r <= 240000; ++r) {
+		if (r == stopRow) csv += ",,,,\n";
+		else csv += std::to_string(r) + ",Item name " + std::to_string(r) + ",Consume," + std::to_string(r * 3) + ",Heal\n";
+	}
+	TestDir dir("parallel_stop");
+	writeTestFile(dir.in() / "Item.csv", csv);
+	CliResult serial = runCsvParser(dir, { dir.in().string(), dir.path("serial").string(), "--parse-jobs", "1" });
+	CHECK_EQ(serial.code, 0);
+	std::string expected = readTestFile(dir.path("serial") / "Item.json");
+	CHECK(expected.find("\"Item name " + std::to_string(stopRow - 1) + "\"") != std::string::npos);
+	CHECK(expected.find("\"Item name " + std::to_string(stopRow + 1) + "\"") == std::string::npos);
+
+	for (const char* jobs : { "2", "4", "8" }) {
+		for (bool stream : { false, true }) {
+			std::string out = std::string(stream ? "stream" : "whole") + jobs;
+			std::vector<std::string> args = { dir.in().string(), dir.path(out).string(), "--parse-jobs", jobs, "--stats=json" };
+			if (stream) args.push_back("--stream");
+			CliResult r = runCsvParser(dir, args);
+			CHECK_EQ(r.code, 0);
+			CHECK(readTestFile(dir.path(out) / "Item.json") == expected);
+			CHECK_EQ(statsValue(r.out, "slice", "rows"), (uint64_t)(stopRow - 1));
+		}
+	}
+}
+
+void runStreamingTests() {
+	testStreamUtf8();
+	testStreamCp949Retry();
+	testParallelStopRow();
+}
@@ -0,0 +1,52 @@
+// TestTokenizer.cpp : CsvTokenizer (블록 비트마스크 토큰화, 제자리 풀기, 끝나지 않은 행)
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "TestCsvUtil.h"
+
+static void testTokenizer() {
+	CHECK_EQ(tokenizeAll("a,b,c\n1,2,3\n"), "[a][b][c]\n[1][2][3]\n");
+	CHECK_EQ(tokenizeAll("a,,\n"), "[a][][]\n");
+	CHECK_EQ(tokenizeAll("a,b\r\nc,d\r\n"), "[a][b]\n[c][d]\n");
+	CHECK_EQ(tokenizeAll("a,b"), "[a][b]\n"); // 마지막 개행 없음
+
+	// 따옴표 안의 쉼표/개행은 필드에 포함
+	CHECK_EQ(tokenizeAll("\"a,b\",c\n"), "[a,b][c]\n");
+	CHECK_EQ(tokenizeAll("\"multi\nline\",x\ny,z\n"), "[multi\nline][x]\n[y][z]\n");
+	CHECK_EQ(tokenizeAll("\"crlf\r\ninside\",x\r\n"), "[crlf\r\ninside][x]\n");
+
+	// "" 는 " 하나
+	CHECK_EQ(tokenizeAll("\"say \"\"hi\"\"\",1\n"), "[say \"hi\"][1]\n");
+	CHECK_EQ(tokenizeAll("\"\"\"\"\n"), "[\"]\n");
+	CHECK_EQ(tokenizeAll("\"\",x\n"), "[][x]\n");
+
+	// 닫히지 않은 따옴표는 파일 끝까지 한 필드
+	CHECK_EQ(tokenizeAll("a,\"open\nb,c\nd"), "[a][open\nb,c\nd]\n");
+
+	// 64바이트 블록 경계를 넘는 따옴표 필드
+	std::string longField(150, 'x');
+	longField[63] = ',';
+	longField[64] = '\n';
+	longField[127] = '"';
+	std::string quoted = "\"" + longField.substr(0, 127) + "\"\"" + longField.substr(128) + "\"";
+	CHECK_EQ(tokenizeAll("k," + quoted + "\nnext\n"),
+		"[k][" + longField.substr(0, 127) + "\"" + longField.substr(128) + "]\n[next]\n");
+
+	// 제자리 풀기도 같은 결과
+	const char* samples[] = { "a,\"b\"\"c\",d\n", "\"multi\nline\",x\ny,z\n", "a,\"open\nb,c\nd" };
+	for (const char* s : samples)
+		CHECK_EQ(tokenizeAllInPlace(s), tokenizeAll(s));
+
+	// last == false 면 끝나지 않은 행(따옴표 안 개행 포함)은 남기고 소비한 길이를 돌려준다
+	std::string part = "a,b\n\"c\nd";
+	std::string out;
+	CsvTokenizer tok;
+	size_t used = tok.tokenize(part.data(), part.size(), false, [&](const std::vector<std::string_view>& f) { appendRow(out, f); });
+	CHECK_EQ(used, (size_t)4);
+	CHECK_EQ(out, "[a][b]\n");
+}
+
+void runTokenizerTests() {
+	testTokenizer();
+}
@@ -0,0 +1,144 @@
+// TestUtf16.cpp : Utf16ToUtf8Length / AppendUtf16AsUtf8 (SSE2 8유닛 경로와 유닛 단위 기준 구현 비교)
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TestUtil.h"
+#include "../TextRPG/Utf16.h"
+
+static void appendUtf8(std::string& out, uint32_t c) {
+	if (c < 0x80) out += (char)c;
+	else if (c < 0x800) {
+		out += (char)(0xC0 | (c >> 6));
+		out += (char)(0x80 | (c & 0x3F));
+	}
+	else if (c < 0x10000) {
+		out += (char)(0xE0 | (c >> 12));
+		out += (char)(0x80 | ((c >> 6) & 0x3F));
+		out += (char)(0x80 | (c & 0x3F));
+	}
+	else {
+		out += (char)(0xF0 | (c >> 18));
+		out += (char)(0x80 | ((c >> 12) & 0x3F));
+		out += (char)(0x80 | ((c >> 6) & 0x3F));
+		out += (char)(0x80 | (c & 0x3F));
+	}
+}
+
+// 서로게이트 쌍은 합치고, 짝 없는 서로게이트는 U+FFFD
+static std::string scalarUtf8(const std::vector<uint16_t>& u) {
+	std::string out;
+	for (size_t i = 0; i < u.size(); ++i) {
+		uint32_t c = u[i];
+		if (c >= 0xD800 && c <= 0xDBFF && i + 1 < u.size() && u[i + 1] >= 0xDC00 && u[i + 1] <= 0xDFFF)
+			c = 0x10000 + ((c - 0xD800) << 10) + (u[++i] - 0xDC00);
+		else if (c >= 0xD800 && c <= 0xDFFF)
+			c = 0xFFFD;
+		appendUtf8(out, c);
+	}
+	return out;
+}
+
+static std::string toBytes(const std::vector<uint16_t>& u, bool bigEndian) {
+	std::string b;
+	for (uint16_t c : u) {
+		char lo = (char)(c & 0xFF), hi = (char)(c >> 8);
+		b += bigEndian ? hi : lo;
+		b += bigEndian ? lo : hi;
+	}
+	return b;
+}
+
+// 바탕: ASCII, 2바이트(라틴/키릴), 한글, ASCII 와 한글이 섞인 짧은 구간
+static std::vector<uint16_t> background(int kind, size_t len) {
+	static const std::vector<uint16_t> fills[] = {
+		{ 'a', 'b', '1', ',', ' ', '"', 0x7F, 0x00 },
+		{ 0x80, 0xE9, 0x7FF, 0x416 },
+		{ 0xAC00, 0xD7A3, 0x800, 0xFFFF, 0xE000 },
+		{ 0xD55C, ' ', 0xAE00, '"', 'x', 0x3B1 },
+	};
+	const std::vector<uint16_t>& f = fills[kind];
+	std::vector<uint16_t> u;
+	for (size_t i = 0; i < len; ++i) u.push_back(f[i % f.size()]);
+	return u;
+}
+
+static size_t g_mismatches = 0;
+
+static void checkUnits(const std::vector<uint16_t>& u) {
+	const std::string expected = scalarUtf8(u);
+	for (bool be : { false, true }) {
+		const std::string b = toBytes(u, be);
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(b.data());
+		if (Utf16ToUtf8Length(p, u.size(), be) != expected.size()) ++g_mismatches;
+		std::string out = "pre";
+		AppendUtf16AsUtf8(p, b.size(), be, out);
+		if (out != "pre" + expected) ++g_mismatches;
+	}
+}
+
+// 8유닛 블록 경계 앞뒤의 ASCII 구간 길이
+static void testAsciiRuns() {
+	for (size_t run : { 7u, 8u, 9u, 16u, 17u }) {
+		std::vector<uint16_t> u = background(0, run);
+		checkUnits(u);
+		u.push_back(0xD55C);
+		checkUnits(u);
+		u.insert(u.begin(), 0xAE00);
+		checkUnits(u);
+	}
+	std::vector<uint16_t> ascii = { 'K', 'e', 'y', ',', '1', '2', '3', '\n', 'a' };
+	std::string out;
+	std::string b = toBytes(ascii, false);
+	AppendUtf16AsUtf8(reinterpret_cast<const unsigned char*>(b.data()), b.size(), false, out);
+	CHECK_EQ(out, "Key,123\na");
+	CHECK_EQ(g_mismatches, (size_t)0);
+}
+
+// 모든 바탕/길이에서 각 위치에 서로게이트 쌍(pos%8 == 7 이면 블록 경계를 걸침)과 짝 없는 서로게이트를 넣는다
+static void testSurrogates() {
+	size_t cases = 0;
+	for (int kind = 0; kind < 4; ++kind) {
+		for (size_t len = 0; len <= 40; ++len) {
+			const std::vector<uint16_t> base = background(kind, len);
+			checkUnits(base);
+			++cases;
+			for (size_t pos = 0; pos < len; ++pos) {
+				std::vector<uint16_t> u = base;
+				u[pos] = 0xD83D; // 😀 = D83D DE00
+				if (pos + 1 < len) u[pos + 1] = 0xDE00;
+				checkUnits(u); // 끝이면 짝 없는 상위 서로게이트
+				u = base;
+				u[pos] = 0xDC00; // 짝 없는 하위 두 개
+				if (pos + 1 < len) u[pos + 1] = 0xDFFF;
+				checkUnits(u);
+				u = base;
+				u[pos] = 0xDBFF; // 상위 뒤에 상위
+				if (pos + 1 < len) u[pos + 1] = 0xD800;
+				checkUnits(u);
+				cases += 3;
+			}
+		}
+	}
+	CHECK_EQ(g_mismatches, (size_t)0);
+	CHECK(cases > 3000);
+
+	// 기준 구현 자체도 확인
+	CHECK_EQ(scalarUtf8({ 0xD83D, 0xDE00 }), "\xF0\x9F\x98\x80");
+	CHECK_EQ(scalarUtf8({ 0xDC00, 'a', 0xD800 }), "\xEF\xBF\xBD" "a" "\xEF\xBF\xBD");
+	CHECK_EQ(scalarUtf8({ 0xD55C, 0xAE00 }), "\xED\x95\x9C\xEA\xB8\x80");
+}
+
+// 끝의 홀수 바이트는 버린다
+static void testOddTail() {
+	std::string b = toBytes(background(3, 12), false) + "x";
+	std::string out;
+	AppendUtf16AsUtf8(reinterpret_cast<const unsigned char*>(b.data()), b.size(), false, out);
+	CHECK_EQ(out, scalarUtf8(background(3, 12)));
+}
+
+void runUtf16Tests() {
+	testAsciiRuns();
+	testSurrogates();
+	testOddTail();
+}
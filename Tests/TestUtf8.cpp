@@ -0,0 +1,31 @@
+// TestUtf8.cpp : utf8FirstInvalid (UTF-8 전체 규칙 검증과 오류 위치)
+#include <string>
+
+#include "TestUtil.h"
+#include "../CSVParser/TextEncoding.h"
+
+static void testUtf8Validator() {
+	CHECK_EQ(utf8FirstInvalid(std::string("")), kUtf8Valid);
+	CHECK_EQ(utf8FirstInvalid(std::string("plain ascii")), kUtf8Valid);
+	CHECK_EQ(utf8FirstInvalid(std::string("회복포션 \xF0\x9F\x98\x80 \xC3\xA9")), kUtf8Valid);
+
+	CHECK_EQ(utf8FirstInvalid(std::string("ab\xFF")), (size_t)2);          // 쓰이지 않는 바이트
+	CHECK_EQ(utf8FirstInvalid(std::string("a\x80")), (size_t)1);           // 리드 없는 연속 바이트
+	CHECK_EQ(utf8FirstInvalid(std::string("a\xC0\x80")), (size_t)1);       // overlong
+	CHECK_EQ(utf8FirstInvalid(std::string("\xED\xA0\x80")), (size_t)0);    // 서로게이트
+	CHECK_EQ(utf8FirstInvalid(std::string("\xF4\x90\x80\x80")), (size_t)0); // U+10FFFF 초과
+	CHECK_EQ(utf8FirstInvalid(std::string("ok\xEA\xB0")), (size_t)2);      // 끝에서 잘림
+	CHECK_EQ(utf8FirstInvalid(std::string("\xB0\xA1")), (size_t)0);        // CP949 "가"
+
+	// 블록 단위 경로: 앞이 긴 ASCII/한글일 때도 정확한 오프셋
+	std::string ascii(100, 'a');
+	CHECK_EQ(utf8FirstInvalid(ascii + "\xFF"), (size_t)100);
+	std::string korean;
+	for (int k = 0; k < 40; ++k) korean += "\xEA\xB0\x80"; // 가 x 40 = 120 바이트
+	CHECK_EQ(utf8FirstInvalid(korean), kUtf8Valid);
+	CHECK_EQ(utf8FirstInvalid(korean + "\xEA\xB0" + ascii), (size_t)120);
+}
+
+void runUtf8Tests() {
+	testUtf8Validator();
+}
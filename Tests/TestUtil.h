@@ -0,0 +1,68 @@
+// TestUtil.h : 외부 라이브러리 없는 아주 작은 테스트 도우미
+// CHECK / CHECK_EQ 는 실패해도 멈추지 않고 위치와 값을 찍은 뒤 계속한다.
+// 그룹(runXxxTests) 하나가 끝나면 Tests.cpp 가 실패 개수로 종료 코드를 정한다.
+#pragma once
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+struct TestCounters {
+	int checks = 0;
+	int failures = 0;
+};
+
+inline TestCounters& testCounters() {
+	static TestCounters c;
+	return c;
+}
+
+inline bool testCheck(bool ok, const char* expr, const char* file, int line) {
+	TestCounters& c = testCounters();
+	++c.checks;
+	if (!ok) {
+		++c.failures;
+		std::printf("  FAIL %s:%d: %s\n", file, line, expr);
+	}
+	return ok;
+}
+
+template <class A, class B>
+bool testCheckEq(const A& actual, const B& expected, const char* expr, const char* file, int line) {
+	if (testCheck(actual == expected, expr, file, line)) return true;
+	std::ostringstream a, e;
+	a << actual;
+	e << expected;
+	std::printf("    actual:   \"%s\"\n    expected: \"%s\"\n", a.str().c_str(), e.str().c_str());
+	return false;
+}
+
+#define CHECK(cond) testCheck((cond), #cond, __FILE__, __LINE__)
+#define CHECK_EQ(actual, expected) testCheckEq((actual), (expected), #actual " == " #expected, __FILE__, __LINE__)
+
+// 예외가 나야 통과
+#define CHECK_THROWS(stmt) do { \
+		bool thrown_ = false; \
+		try { stmt; } catch (...) { thrown_ = true; } \
+		testCheck(thrown_, "throws: " #stmt, __FILE__, __LINE__); \
+	} while (0)
+
+// -------------------- 테스트 묶음 --------------------
+// 요청(기능)마다 파일 하나, 그룹 하나. Tests.cpp 의 표와 CMakeLists.txt 의 add_test 에도 같이 추가한다.
+void runTokenizerTests();   // TestTokenizer.cpp : CsvTokenizer
+void runSplitRowsTests();   // TestSplitRows.cpp : csvSplitRows
+void runUtf8Tests();        // TestUtf8.cpp : utf8FirstInvalid
+void runCp949Tests();       // TestCp949.cpp : cp949ToUtf8
+void runJsonParserTests();  // TestJsonParser.cpp : JsonParser 문자열/숫자 fast path
+void runBinTableTests();    // TestBinTable.cpp : .bin 쓰기 → 읽기 왕복
+void runNdjsonTests();      // TestNdjson.cpp : NDJSON 분할 로드
+void runStreamingTests();   // TestStreaming.cpp : --stream 변환 (명령줄)
+void runManifestTests();    // TestManifest.cpp : 증분 변환 매니페스트 (명령줄)
+void runItemStoreTests();   // TestItemStore.cpp : StringPool, ItemStore
+void runItemIndexTests();   // TestItemIndex.cpp : IdIndex, ItemManager::FindItem
+void runShopTests();        // TestShop.cpp : ShopManager
+void runSnapshotTests();    // TestSnapshot.cpp : SnapshotSlot (동시 Load / Store)
+void runLazyLoadTests();    // TestLazyLoad.cpp : LoadMode::Lazy
+void runJsonWriterTests();  // TestJsonWriter.cpp : JsonTableWriter (JSON / NDJSON)
+void runJsonEscapeTests();  // TestJsonEscape.cpp : jsonFindEscape, appendJsonEscaped
+void runColumnTypesTests(); // TestColumnTypes.cpp : ColumnTypeInfer, resolveColumnSpecs
+void runUtf16Tests();       // TestUtf16.cpp : Utf16ToUtf8Length, AppendUtf16AsUtf8
@@ -0,0 +1,42 @@
+// Tests.cpp : CSVParser / TextRPG 단위 테스트 실행기
+// 사용법: tests [그룹 이름]  (없으면 전부). 실패가 하나라도 있으면 종료 코드 1.
+#include <cstdio>
+#include <cstring>
+
+#include "TestUtil.h"
+
+int main(int argc, char** argv) {
+	const char* only = argc > 1 ? argv[1] : nullptr;
+	struct Group { const char* name; void (*run)(); };
+	const Group groups[] = {
+		{ "tokenizer", &runTokenizerTests },
+		{ "split", &runSplitRowsTests },
+		{ "utf8", &runUtf8Tests },
+		{ "cp949", &runCp949Tests },
+		{ "json", &runJsonParserTests },
+		{ "bin", &runBinTableTests },
+		{ "ndjson", &runNdjsonTests },
+		{ "stream", &runStreamingTests },
+		{ "manifest", &runManifestTests },
+		{ "itemstore", &runItemStoreTests },
+		{ "itemindex", &runItemIndexTests },
+		{ "shop", &runShopTests },
+		{ "snapshot", &runSnapshotTests },
+		{ "lazyload", &runLazyLoadTests },
+		{ "jsonwriter", &runJsonWriterTests },
+		{ "jsonescape", &runJsonEscapeTests },
+		{ "columntypes", &runColumnTypesTests },
+		{ "utf16", &runUtf16Tests },
+	};
+
+	for (const Group& g : groups) {
+		if (only && std::strcmp(only, g.name) != 0) continue;
+		int before = testCounters().failures;
+		std::printf("[%s]\n", g.name);
+		g.run();
+		std::printf("[%s] %s\n", g.name, testCounters().failures == before ? "ok" : "FAILED");
+	}
+	const TestCounters& c = testCounters();
+	std::printf("%d checks, %d failures\n", c.checks, c.failures);
+	return c.failures ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+﻿#include "BinTable.h"
+
+// ---------- Open / Close ----------
+bool BinTable::Open(const std::string& pathUtf8)
+{
+	Close();
+	error.clear();
+
+	if (!file.Open(pathUtf8))
+		return Fail(file.LastError());
+	if (file.Size() == 0)
+		return Fail("empty file: " + pathUtf8);
+	base = file.Data();
+
+	if (!Validate(file.Size()))
+	{
+		std::string why = error;
+		Close();
+		error = pathUtf8 + ": " + why;
+		return false;
+	}
+	return true;
+}
+
+void BinTable::Close()
+{
+	file.Close();
+	base = nullptr;
+	header = nullptr;
+	columns = nullptr;
+}
+
+bool BinTable::Fail(const std::string& why)
+{
+	Close();
+	error = why;
+	return false;
+}
+
+// ---------- 검증 ----------
+// 헤더/컬럼 구역만 확인한다(컬럼 수만큼, 행 수와 무관). 이후 숫자 Get* 은 검사 없이 바로 읽고,
+// 행마다 다른 문자열 참조만 GetString 에서 힙 범위를 확인한다.
+bool BinTable::Validate(uint64_t size)
+{
+	if (size < sizeof(BinTableHeader))
+		return Fail("too small");
+
+	const BinTableHeader* h = reinterpret_cast<const BinTableHeader*>(base);
+	if (std::memcmp(h->magic, BIN_TABLE_MAGIC, sizeof(h->magic)) != 0)
+		return Fail("not a table file");
+	if (h->version != BIN_TABLE_VERSION)
+		return Fail("unsupported version " + std::to_string(h->version));
+	if (h->headerSize != sizeof(BinTableHeader) || h->fileSize != size)
+		return Fail("corrupted header");
+
+	// 구역이 파일 안에 있는지 (overflow 없이)
+	auto inside = [size](uint64_t off, uint64_t len) {
+		return off <= size && len <= size - off;
+		};
+	if (h->columnCount > size / sizeof(BinColumnDesc)
+		|| !inside(h->columnsOffset, uint64_t(h->columnCount) * sizeof(BinColumnDesc))
+		|| h->columnsOffset % 8 != 0
+		|| !inside(h->heapOffset, h->heapSize))
+		return Fail("corrupted header");
+
+	const BinColumnDesc* cols = reinterpret_cast<const BinColumnDesc*>(base + h->columnsOffset);
+	for (uint32_t c = 0; c < h->columnCount; ++c)
+	{
+		const BinColumnDesc& d = cols[c];
+		uint64_t width;
+		switch (d.type)
+		{
+		case BCT_INT: width = sizeof(int64_t); break;
+		case BCT_FLOAT: width = sizeof(double); break;
+		case BCT_BOOL: width = sizeof(uint8_t); break;
+		case BCT_STRING: width = sizeof(BinStringRef); break;
+		default: return Fail("unknown column type");
+		}
+		if (h->rowCount > size / width
+			|| !inside(d.dataOffset, h->rowCount * width)
+			|| uint64_t(d.nameOffset) + d.nameLength > h->heapSize
+			|| (d.nullOffset && !inside(d.nullOffset, (h->rowCount + 7) / 8)))
+			return Fail("corrupted column " + std::to_string(c));
+	}
+
+	header = h;
+	columns = cols;
+	return true;
+}
+
+// ---------- 조회 ----------
+std::string_view BinTable::HeapString(uint32_t offset, uint32_t length) const
+{
+	return std::string_view(reinterpret_cast<const char*>(base + header->heapOffset + offset), length);
+}
+
+int BinTable::FindColumn(std::string_view name) const
+{
+	for (uint32_t c = 0; c < ColumnCount(); ++c)
+	{
+		if (HeapString(columns[c].nameOffset, columns[c].nameLength) == name)
+			return static_cast<int>(c);
+	}
+	return -1;
+}
+
+bool BinTable::IsNull(int col, uint64_t row) const
+{
+	uint64_t off = columns[col].nullOffset;
+	if (off == 0)
+		return false;
+	return (base[off + row / 8] >> (row % 8)) & 1;
+}
+
+std::string_view BinTable::GetString(int col, uint64_t row) const
+{
+	BinStringRef ref;
+	std::memcpy(&ref, base + columns[col].dataOffset + row * sizeof(BinStringRef), sizeof(ref));
+	if (uint64_t(ref.offset) + ref.length > header->heapSize)
+		throw std::runtime_error("BinTable: corrupted string in column " + std::to_string(col)
+			+ " row " + std::to_string(row));
+	return HeapString(ref.offset, ref.length);
+}
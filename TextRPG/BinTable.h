@@ -0,0 +1,62 @@
+﻿// BinTable.h : CSVParser --format bin 출력(.bin)을 메모리 매핑해서 읽는다.
+// 파일을 통째로 매핑한 뒤 헤더/컬럼 범위만 검증하고(행 수와 무관), 값은 매핑된 메모리에서 바로 꺼낸다(복사/파싱 없음).
+// 행마다 있는 문자열 참조는 Open 에서 훑지 않고 GetString 이 읽을 때 힙 범위를 확인한다.
+// 문자열은 매핑 안을 가리키는 string_view 이므로 Close 전까지만 유효하다.
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "BinTableFormat.h"
+#include "MappedFile.h"
+
+class BinTable {
+public:
+    BinTable() = default;
+    ~BinTable() { Close(); }
+    BinTable(const BinTable&) = delete;
+    BinTable& operator=(const BinTable&) = delete;
+
+    // 실패(없음/형식 오류)하면 false, 이유는 LastError()
+    bool Open(const std::string& pathUtf8);
+    void Close();
+
+    bool IsOpen() const { return base != nullptr; }
+    const std::string& LastError() const { return error; }
+
+    uint64_t RowCount() const { return header ? header->rowCount : 0; }
+    uint32_t ColumnCount() const { return header ? header->columnCount : 0; }
+
+    // 이름으로 컬럼 찾기. 없으면 -1
+    int FindColumn(std::string_view name) const;
+    BinColumnType ColumnType(int col) const { return static_cast<BinColumnType>(columns[col].type); }
+
+    // row/col 범위와 타입은 호출자가 맞춘다(FindColumn + ColumnType 로 한 번 확인).
+    // GetString 은 참조가 힙 밖을 가리키면(손상된 파일) std::runtime_error.
+    bool IsNull(int col, uint64_t row) const;
+    int64_t GetInt(int col, uint64_t row) const { return Load<int64_t>(col, row); }
+    double GetFloat(int col, uint64_t row) const { return Load<double>(col, row); }
+    bool GetBool(int col, uint64_t row) const { return Load<uint8_t>(col, row) != 0; }
+    std::string_view GetString(int col, uint64_t row) const;
+
+private:
+    bool Fail(const std::string& why);
+    bool Validate(uint64_t size);
+    std::string_view HeapString(uint32_t offset, uint32_t length) const;
+
+    template <class T>
+    T Load(int col, uint64_t row) const
+    {
+        T v;
+        std::memcpy(&v, base + columns[col].dataOffset + row * sizeof(T), sizeof(T));
+        return v;
+    }
+
+    MappedFile file;
+    const unsigned char* base = nullptr; // file.Data()
+    const BinTableHeader* header = nullptr;
+    const BinColumnDesc* columns = nullptr;
+    std::string error;
+};
@@ -0,0 +1,57 @@
+﻿#pragma once
+// BinTableFormat.h : CSVParser --format bin 출력(.bin)의 파일 레이아웃
+// CSVParser(쓰기)와 TextRPG(읽기)가 같이 include 한다. 리틀 엔디언 기준.
+//
+// [BinTableHeader][BinColumnDesc x columnCount][컬럼 데이터...][문자열 힙]
+// - 모든 구역은 8바이트 정렬
+// - INT   : int64_t[rowCount]
+// - FLOAT : double[rowCount]
+// - BOOL  : uint8_t[rowCount]
+// - STRING: BinStringRef[rowCount] (힙 안의 offset/length, UTF-8, 끝 0 없음)
+// - nullOffset 이 0 이 아니면 rowCount 비트짜리 null 비트맵(1 = 빈 칸)
+#include <cstdint>
+
+static const char     BIN_TABLE_MAGIC[8] = { 'T', 'R', 'P', 'G', 'T', 'B', 'L', '\0' };
+static const uint32_t BIN_TABLE_VERSION = 1;
+
+enum BinColumnType : uint8_t
+{
+	BCT_INT = 1,
+	BCT_FLOAT = 2,
+	BCT_BOOL = 3,
+	BCT_STRING = 4,
+};
+
+struct BinTableHeader
+{
+	char     magic[8];
+	uint32_t version;
+	uint32_t headerSize;    // sizeof(BinTableHeader)
+	uint32_t columnCount;
+	uint32_t reserved;
+	uint64_t rowCount;
+	uint64_t columnsOffset; // BinColumnDesc 배열
+	uint64_t heapOffset;
+	uint64_t heapSize;
+	uint64_t fileSize;
+};
+
+struct BinColumnDesc
+{
+	uint32_t nameOffset;    // 힙 안의 컬럼명
+	uint32_t nameLength;
+	uint8_t  type;          // BinColumnType
+	uint8_t  reserved[7];
+	uint64_t dataOffset;
+	uint64_t nullOffset;    // 0 이면 null 없음
+};
+
+struct BinStringRef
+{
+	uint32_t offset;
+	uint32_t length;
+};
+
+static_assert(sizeof(BinTableHeader) == 64, "BinTableHeader layout");
+static_assert(sizeof(BinColumnDesc) == 32, "BinColumnDesc layout");
+static_assert(sizeof(BinStringRef) == 8, "BinStringRef layout");
@@ -1,17 +1,30 @@
 ﻿#include "DataManager.h"
+#include "MappedFile.h"
+#include "TableLoader.h"
+#include "TableSchemas.h"
+#include "Utf16.h"
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
-#include <cstdlib> // strtol
+#include <cstdlib>
+#include <algorithm>
 
 #ifdef _WIN32
-#include <windows.h>
 #include <codecvt>
+#include <locale>
+#include <windows.h>
 #else
 #include <unistd.h>
 #include <limits.h>
 #endif
 
+#ifdef __linux__
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#endif
+
 #include <iostream>
 
 // ---------- Singleton ----------
@@ -21,12 +34,20 @@ DataManager& DataManager::Instance()
 	return inst;
 }
 
+DataManager::DataManager()
+{
+	RegisterTable(TABLE_ITEM, "Item", [this]() { PublishItems(); });
+	RegisterTable(TABLE_SHOP, "Shop", [this]() { PublishShops(); });
+}
+
 // ---------- Path / IO ----------
 #ifdef _WIN32
 std::string DataManager::ToUtf8(const std::wstring& w) const
 {
-	std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> conv;
-	return conv.to_bytes(w);
+	// Windows 의 wchar_t 는 UTF-16 LE
+	std::string out;
+	AppendUtf16AsUtf8(reinterpret_cast<const unsigned char*>(w.data()), w.size() * sizeof(wchar_t), false, out);
+	return out;
 }
 std::wstring DataManager::ToWide(const std::string& u8) const
 {
@@ -46,15 +67,6 @@ std::string DataManager::ResolveFromResourcesOutput(const std::string& relative)
 #endif
 }
 
-// ---- 헬퍼: 바이트 프리픽스 검사
-static bool has_prefix(const std::vector<unsigned char>& buf,
-	std::initializer_list<unsigned char> p) {
-	if (buf.size() < p.size()) return false;
-	size_t i = 0;
-	for (auto v : p) { if (buf[i++] != v) return false; }
-	return true;
-}
-
 std::string DataManager::ReadFileToString(const std::string& pathUtf8) const
 {
 #ifdef _WIN32
@@ -64,87 +76,220 @@ std::string DataManager::ReadFileToString(const std::string& pathUtf8) const
 #endif
 	if (!ifs) throw std::runtime_error("failed to open: " + pathUtf8);
 
-	// 전체 읽기
-	std::vector<unsigned char> buf;
 	ifs.seekg(0, std::ios::end);
 	std::streamoff sz = ifs.tellg();
 	ifs.seekg(0, std::ios::beg);
-	if (sz > 0)
-	{
-		buf.resize(static_cast<size_t>(sz));
-		ifs.read(reinterpret_cast<char*>(buf.data()), sz);
-	}
-	if (buf.empty())
+	if (sz <= 0)
 		return std::string();
+	size_t size = static_cast<size_t>(sz);
 
 	// --- 인코딩 처리 ---
-	// 1) UTF-8 BOM → 제거
-	if (has_prefix(buf, { 0xEF, 0xBB, 0xBF })) {
-		return std::string(reinterpret_cast<const char*>(buf.data() + 3),
-			reinterpret_cast<const char*>(buf.data() + buf.size()));
-	}
-
-	// 2) UTF-16 LE → UTF-8 변환
-	if (has_prefix(buf, { 0xFF, 0xFE })) {
-		const uint16_t* w = reinterpret_cast<const uint16_t*>(buf.data() + 2);
-		size_t wc = (buf.size() - 2) / 2;
-		std::wstring ws; ws.resize(wc);
-		for (size_t i = 0; i < wc; ++i) ws[i] = static_cast<wchar_t>(w[i]);
-		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> conv;
-		return conv.to_bytes(ws);
-	}
-
-	// 3) UTF-16 BE → UTF-8 변환
-	if (has_prefix(buf, { 0xFE, 0xFF })) {
-		const unsigned char* p = buf.data() + 2;
-		size_t wc = (buf.size() - 2) / 2;
-		std::wstring ws; ws.resize(wc);
-		for (size_t i = 0; i < wc; ++i) {
-			uint16_t u = (static_cast<uint16_t>(p[2 * i]) << 8) | static_cast<uint16_t>(p[2 * i + 1]);
-			ws[i] = static_cast<wchar_t>(u);
-		}
-		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> conv;
-		return conv.to_bytes(ws);
+	// BOM 만 먼저 읽고, 본문은 BOM 뒤부터 바로 최종 버퍼(또는 UTF-16 원문 버퍼)로 읽는다.
+	unsigned char bom[3] = {};
+	ifs.read(reinterpret_cast<char*>(bom), static_cast<std::streamsize>(std::min<size_t>(size, 3)));
+	size_t skip = 0;
+	bool utf16 = false, bigEndian = false;
+	if (size >= 3 && bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF)
+	{
+		// 1) UTF-8 BOM → 제거
+		skip = 3;
 	}
+	else if (size >= 2 && bom[0] == 0xFF && bom[1] == 0xFE)
+	{
+		// 2) UTF-16 LE
+		skip = 2;
+		utf16 = true;
+	}
+	else if (size >= 2 && bom[0] == 0xFE && bom[1] == 0xFF)
+	{
+		// 3) UTF-16 BE
+		skip = 2;
+		utf16 = bigEndian = true;
+	}
+	ifs.clear();
+	ifs.seekg(static_cast<std::streamoff>(skip), std::ios::beg);
 
 	// 4) 그 외는 UTF-8/ASCII로 간주
-	return std::string(reinterpret_cast<const char*>(buf.data()),
-		reinterpret_cast<const char*>(buf.data() + buf.size()));
-}
-JsonValue DataManager::ParseJsonFile(const std::string& pathUtf8) const
-{
-	std::string s = ReadFileToString(pathUtf8);
-	JsonParser p(s);
-	return p.parse();
+	if (!utf16)
+	{
+		std::string out(size - skip, '\0');
+		if (!out.empty())
+			ifs.read(&out[0], static_cast<std::streamsize>(out.size()));
+		return out;
+	}
+
+	std::vector<unsigned char> raw(size - skip);
+	if (!raw.empty())
+		ifs.read(reinterpret_cast<char*>(raw.data()), static_cast<std::streamsize>(raw.size()));
+	std::string out;
+	AppendUtf16AsUtf8(raw.data(), raw.size(), bigEndian, out);
+	return out;
 }
 
-// ---------- Initialize (부팅 시 1회) ----------
-bool DataManager::Initialize()
+// ---------- 테이블 로더 ----------
+bool DataManager::LoadItemTable(ItemTable& out) const
 {
-	if (bInitialized)
-		return bInitialized;
+	out.clear();
+
+	// Item.bin 이 있으면 우선 (CSVParser --format bin, 파싱 없이 매핑해서 읽음)
+	{
+		BinTable table;
+		if (table.Open(ResolveFromResourcesOutput("Item.bin")))
+		{
+			try
+			{
+				LoadItemsBin(table, out);
+				return true;
+			}
+			catch (...)
+			{
+				out.clear(); // 손상된 문자열 참조 (BinTable::GetString)
+				return false;
+			}
+		}
+	}
+
+	// 다음은 Item.ndjson (CSVParser --format ndjson, 매핑한 파일을 줄 단위로 나눠 여러 스레드로 파싱)
+	{
+		MappedFile file;
+		if (file.Open(ResolveFromResourcesOutput("Item.ndjson")))
+		{
+			try
+			{
+				LoadItemsNdjson(file.View(), out);
+				return true;
+			}
+			catch (...)
+			{
+				out.clear();
+				return false;
+			}
+		}
+	}
 
 	// items.json (최상위 배열: {"Idx","Name","Effect","Type","Value"})
 	try
 	{
 		std::string path = ResolveFromResourcesOutput("Item.json");
-		JsonValue root = ParseJsonFile(path);
-		LoadItemsJson(root);
+		LoadItemsJson(ReadFileToString(path), out);
+		return true;
 	}
 	catch (...)
 	{
-		std::cout << "Item.json do not exist!" << '\n';
+		out.clear();
+		return false;
+	}
+}
+
+bool DataManager::LoadShopTable(ShopTable& out) const
+{
+	out.clear();
+
+	// Shop.bin > Shop.ndjson > Shop.json (최상위 배열: {"ShopId","ItemIdx","Price","Stock"})
+	{
+		BinTable table;
+		if (table.Open(ResolveFromResourcesOutput("Shop.bin")))
+		{
+			try
+			{
+				LoadShopBin(table, out);
+				return true;
+			}
+			catch (...)
+			{
+				out.clear(); // 손상된 문자열 참조 (BinTable::GetString)
+				return false;
+			}
+		}
+	}
+
+	{
+		MappedFile file;
+		if (file.Open(ResolveFromResourcesOutput("Shop.ndjson")))
+		{
+			try
+			{
+				LoadShopNdjson(file.View(), out);
+				return true;
+			}
+			catch (...)
+			{
+				out.clear();
+				return false;
+			}
+		}
 	}
 
 	try
 	{
 		std::string path = ResolveFromResourcesOutput("Shop.json");
-		JsonValue root = ParseJsonFile(path);
-		//LoadShopJson(root);
+		LoadShopJson(ReadFileToString(path), out);
+		return true;
 	}
 	catch (...)
 	{
-		std::cout << "Shop.json do not exist!" << '\n';
+		out.clear();
+		return false;
+	}
+}
+
+// ---------- 지연 로드 ----------
+void DataManager::RegisterTable(TableId id, const char* name, std::function<void()> publish)
+{
+	Tables[id].name = name;
+	Tables[id].publish = std::move(publish);
+}
+
+void DataManager::EnsureLoaded(TableId id)
+{
+	DeferredTable& t = Tables[id];
+	if (t.loaded.load(std::memory_order_acquire)) // 로드 후에는 여기서 끝(락 없음)
+		return;
+	std::call_once(t.once, [&t]() {
+		t.publish();
+		t.loaded.store(true, std::memory_order_release);
+		});
+}
+
+// 실패해도 빈 테이블을 게시한다(예전 동작과 같음)
+void DataManager::PublishItems()
+{
+	ItemTable items;
+	if (!LoadItemTable(items))
+		std::cout << "Item.json do not exist!\n";
+	ItemSnapshot.Store(std::make_shared<const ItemTable>(std::move(items)));
+}
+
+void DataManager::PublishShops()
+{
+	ShopTable shops;
+	if (!LoadShopTable(shops))
+		std::cout << "Shop.json do not exist!\n";
+	ShopSnapshot.Store(std::make_shared<const ShopTable>(std::move(shops)));
+}
+
+// ---------- Initialize (부팅 시 1회) ----------
+bool DataManager::Initialize(LoadMode mode)
+{
+	if (bInitialized)
+		return bInitialized;
+
+	if (mode == LoadMode::Parallel)
+	{
+		// 테이블 하나씩 가져가는 작은 풀 → 부팅 시간은 가장 큰 테이블 정도
+		unsigned hw = std::thread::hardware_concurrency();
+		unsigned workers = std::min<unsigned>(TABLE_COUNT, hw ? hw : 2);
+		std::atomic<int> next{ 0 };
+		auto work = [&]() {
+			for (int id; (id = next.fetch_add(1)) < TABLE_COUNT; )
+				EnsureLoaded(static_cast<TableId>(id));
+			};
+		std::vector<std::thread> pool;
+		for (unsigned w = 1; w < workers; ++w)
+			pool.emplace_back(work);
+		work(); // 호출한 스레드도 같이 일한다
+		for (std::thread& th : pool)
+			th.join();
 	}
 
 	bInitialized = true;
@@ -152,71 +297,160 @@ bool DataManager::Initialize()
 	return bInitialized;
 }
 
-// ---------- JSON → Items ----------
-void DataManager::LoadItemsJson(const JsonValue& root)
+// ---------- 테이블 로더 ----------
+// 컬럼 바인딩은 TableSchemas.h 의 스키마에서 컴파일 타임에 만들어진다(TableLoader.h).
+void DataManager::LoadItemsJson(const std::string& text, ItemTable& out)
 {
-	ItemDataVector.clear();
+	LoadSchemaJson<ItemSchema>(text, out);
+}
 
-	// 우리가 쓰는 스키마: 최상위가 배열
-	if (root.type != JsonValue::Type::Array)
-		return;
+void DataManager::LoadItemsNdjson(std::string_view text, ItemTable& out)
+{
+	LoadSchemaNdjson<ItemSchema>(text, out);
+}
 
-	ItemDataVector.reserve(root.arr.size());
-	for (const auto& obj : root.arr) {
-		if (obj.type != JsonValue::Type::Object)
-			continue;
+void DataManager::LoadItemsBin(const BinTable& table, ItemTable& out)
+{
+	LoadSchemaBin<ItemSchema>(table, out);
+}
 
-		ItemBase it;
+void DataManager::LoadShopJson(const std::string& text, ShopTable& out)
+{
+	LoadSchemaJson<ShopSchema>(text, out);
+}
 
-		const JsonValue* pIdx = obj.get("Idx");
-		if (pIdx)
-		{
-			if (pIdx->type == JsonValue::Type::String)
-				it.idx = static_cast<int>(std::strtol(pIdx->str.c_str(), nullptr, 10));
-			else if (pIdx->type == JsonValue::Type::Number)
-				it.idx = static_cast<int>(pIdx->number);
-		}
+void DataManager::LoadShopNdjson(std::string_view text, ShopTable& out)
+{
+	LoadSchemaNdjson<ShopSchema>(text, out);
+}
 
-		const JsonValue* pName = obj.get("Name");
-		if (pName && pName->type == JsonValue::Type::String)
-			it.name = (pName->str);
+void DataManager::LoadShopBin(const BinTable& table, ShopTable& out)
+{
+	LoadSchemaBin<ShopSchema>(table, out);
+}
+
+// ---------- Hot reload ----------
+#ifdef __linux__
+bool DataManager::StartHotReload()
+{
+	std::lock_guard<std::mutex> lock(ReloadMutex);
+	if (ReloadThread.joinable())
+		return true;
+
+	int watchFd = inotify_init1(IN_CLOEXEC);
+	if (watchFd < 0)
+		return false;
+	std::string dir = ResolveFromResourcesOutput("");
+	// CSVParser 는 출력 파일을 바로 써서 닫으므로 CLOSE_WRITE, 임시 파일 + rename 으로 쓰는 도구는 MOVED_TO
+	if (inotify_add_watch(watchFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+	{
+		close(watchFd);
+		std::cout << "HotReload: cannot watch " << dir << '\n';
+		return false;
+	}
+	int wakeFd = eventfd(0, EFD_CLOEXEC);
+	if (wakeFd < 0)
+	{
+		close(watchFd);
+		return false;
+	}
+
+	ReloadWakeFd = wakeFd;
+	ReloadThread = std::thread(&DataManager::HotReloadLoop, this, watchFd, wakeFd);
+	return true;
+}
+
+void DataManager::StopHotReload()
+{
+	std::lock_guard<std::mutex> lock(ReloadMutex);
+	if (!ReloadThread.joinable())
+		return;
 
-		const JsonValue* pEffect = obj.get("Effect");
-		if (pEffect && pEffect->type == JsonValue::Type::String)
-			it.effect = (pEffect->str);
+	uint64_t one = 1;
+	ssize_t w = write(ReloadWakeFd, &one, sizeof(one));
+	(void)w;
+	ReloadThread.join();
+	close(ReloadWakeFd);
+	ReloadWakeFd = -1;
+}
 
-		const JsonValue* pType = obj.get("Type");
-		if (pType && pType->type == JsonValue::Type::String)
+void DataManager::HotReloadLoop(int watchFd, int wakeFd)
+{
+	alignas(inotify_event) char buf[4096];
+	bool bItems = false, bShops = false;
+	while (true)
+	{
+		// 바뀐 게 있으면 잠깐(200ms) 더 모아서 한 번에 다시 읽는다(한 번 저장에 이벤트가 여러 개)
+		pollfd fds[2] = { { watchFd, POLLIN, 0 }, { wakeFd, POLLIN, 0 } };
+		int timeout = (bItems || bShops) ? 200 : -1;
+		int r = poll(fds, 2, timeout);
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r < 0 || (fds[1].revents & POLLIN))
+			break;
+
+		if (r == 0)
 		{
-			it.type = ParseItemType(pType->str);
+			// 아직 한 번도 안 읽은(지연 로드) 테이블은 처음 쓸 때 최신 파일을 읽으므로 건너뛴다
+			bItems = bItems && Tables[TABLE_ITEM].loaded.load();
+			bShops = bShops && Tables[TABLE_SHOP].loaded.load();
+			if (bItems)
+			{
+				ItemTable items;
+				if (LoadItemTable(items))
+				{
+					ItemSnapshot.Store(std::make_shared<const ItemTable>(std::move(items)));
+					std::cout << "[Reload] Item" << '\n';
+				}
+				else
+					std::cout << "[Reload] Item failed, keeping previous" << '\n';
+			}
+			if (bShops)
+			{
+				ShopTable shops;
+				if (LoadShopTable(shops))
+				{
+					ShopSnapshot.Store(std::make_shared<const ShopTable>(std::move(shops)));
+					std::cout << "[Reload] Shop" << '\n';
+				}
+				else
+					std::cout << "[Reload] Shop failed, keeping previous" << '\n';
+			}
+			bItems = bShops = false;
+			continue;
 		}
 
-		const JsonValue* pValue = obj.get("Value");
-		if (pValue)
+		ssize_t len = read(watchFd, buf, sizeof(buf));
+		if (len <= 0)
+			continue;
+		for (char* p = buf; p < buf + len; )
 		{
-			if (pValue->type == JsonValue::Type::String)
-				it.value = static_cast<int>(std::strtol(pValue->str.c_str(), nullptr, 10));
-			else if (pValue->type == JsonValue::Type::Number)
-				it.value = static_cast<int>(pValue->number);
+			const inotify_event* ev = reinterpret_cast<const inotify_event*>(p);
+			if (ev->len > 0)
+			{
+				std::string_view name(ev->name);
+				if (name == "Item.json" || name == "Item.ndjson" || name == "Item.bin")
+					bItems = true;
+				else if (name == "Shop.json" || name == "Shop.ndjson" || name == "Shop.bin")
+					bShops = true;
+			}
+			p += sizeof(inotify_event) + ev->len;
 		}
-
-		ItemDataVector.push_back(it);
 	}
+	close(watchFd);
+}
+#else
+// inotify 가 없는 플랫폼은 아직 지원하지 않음
+bool DataManager::StartHotReload()
+{
+	return false;
 }
 
-ItemType DataManager::ParseItemType(const std::string& sRaw)
+void DataManager::StopHotReload()
 {
-	std::string s;
-	s.reserve(sRaw.size());
-	for (char c : sRaw)
-		s.push_back((char)std::tolower((unsigned char)c));
-	if (s == "consume")
-		return IT_CONSUME;
-	return IT_NONE;
 }
 
-// ---------- Move-out ----------
-std::vector<ItemBase> DataManager::TakeItems()
+void DataManager::HotReloadLoop(int, int)
 {
-	return std::move(ItemDataVector);
-}
\ No newline at end of file
+}
+#endif
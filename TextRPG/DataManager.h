@@ -1,36 +1,67 @@
 ﻿// DataManager.h
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <mutex>
-#include "JsonParser.h"
+#include <thread>
+#include "BinTable.h"
+#include "Snapshot.h"
 
 #include "ItemBase.h"
+#include "ShopBase.h"
+
+typedef std::vector<ItemBase> ItemTable;
+typedef std::vector<ShopBase> ShopTable;
+
+// 테이블 로드 시점
+enum class LoadMode {
+    Parallel, // Initialize 에서 등록된 테이블을 작은 스레드 풀로 동시에 로드
+    Lazy,     // 처음 Get* 할 때 그 테이블만 로드 (한 테이블만 쓰는 도구용)
+};
 
 class DataManager {
 public:
     static DataManager& Instance();
 
     // 부팅 시 1회
-    bool Initialize();
+    bool Initialize(LoadMode mode = LoadMode::Parallel);
+
+    // 현재 테이블 스냅샷. 아직 로드 전이면 여기서 로드한다(테이블당 한 번).
+    // 로드된 뒤에는 락 없이 읽고, 받은 스냅샷은 리로드 후에도 그대로 유효(불변).
+    std::shared_ptr<const ItemTable> GetItems() { EnsureLoaded(TABLE_ITEM); return ItemSnapshot.Load(); }
+    std::shared_ptr<const ShopTable> GetShops() { EnsureLoaded(TABLE_SHOP); return ShopSnapshot.Load(); }
 
-    // 소유권 이전(move-out). 두 번째 호출부터는 빈 벡터가 나감.
-    std::vector<ItemBase> TakeItems();
+    // Resources/output 을 감시해서 바뀐 테이블을 백그라운드 스레드에서 다시 읽고
+    // 스냅샷을 교체한다(Linux inotify). 지원하지 않는 플랫폼이면 false.
+    bool StartHotReload();
+    void StopHotReload();
 
 private:
-    DataManager() = default;
-    ~DataManager() = default;
+    DataManager();
+    ~DataManager() { StopHotReload(); }
     DataManager(const DataManager&) = delete;
     DataManager& operator=(const DataManager&) = delete;
 
-    // 파일/경로/파싱 헬퍼
+    // 파일/경로 헬퍼
     std::string ResolveFromResourcesOutput(const std::string& relative) const;
     std::string ReadFileToString(const std::string& pathUtf8) const;
-    JsonValue   ParseJsonFile(const std::string& pathUtf8) const;
 
-    // 개별 로더
-    void LoadItemsJson(const JsonValue& root);
-    ItemType ParseItemType(const std::string& sRaw);
+    // 테이블 단위 로더: .bin > .ndjson > .json 순으로 있는 것을 읽는다. 실패하면 false (out 은 비어 있음)
+    // CSVParser 는 변환할 때 같은 시트의 다른 형식 출력을 지우므로 보통 하나만 있다.
+    bool LoadItemTable(ItemTable& out) const;
+    bool LoadShopTable(ShopTable& out) const;
+
+    // 개별 로더 (NDJSON 은 줄 경계로 나눠 여러 스레드로 읽는다)
+    static void LoadItemsJson(const std::string& text, ItemTable& out);
+    static void LoadShopJson(const std::string& text, ShopTable& out);
+    static void LoadItemsNdjson(std::string_view text, ItemTable& out);
+    static void LoadShopNdjson(std::string_view text, ShopTable& out);
+    static void LoadItemsBin(const BinTable& table, ItemTable& out);
+    static void LoadShopBin(const BinTable& table, ShopTable& out);
 
 #ifdef _WIN32
     std::string  ToUtf8(const std::wstring& w) const;
@@ -40,5 +71,27 @@ private:
 private:
     bool bInitialized = false;
 
-    std::vector<ItemBase> ItemDataVector;
+    // 지연 로드 테이블. 새 테이블은 TableId 와 생성자의 등록 한 줄, Publish 함수를 추가한다.
+    enum TableId { TABLE_ITEM, TABLE_SHOP, TABLE_COUNT };
+    struct DeferredTable {
+        const char* name = "";
+        std::function<void()> publish;    // 읽어서 스냅샷 게시
+        std::once_flag once;
+        std::atomic<bool> loaded{ false };
+    };
+    DeferredTable Tables[TABLE_COUNT];
+
+    void RegisterTable(TableId id, const char* name, std::function<void()> publish);
+    void EnsureLoaded(TableId id);
+    void PublishItems();
+    void PublishShops();
+
+    SnapshotSlot<ItemTable> ItemSnapshot;
+    SnapshotSlot<ShopTable> ShopSnapshot;
+
+    // 핫 리로드
+    void HotReloadLoop(int watchFd, int wakeFd);
+    std::thread ReloadThread;
+    int ReloadWakeFd = -1;  // 여기에 쓰면 감시 스레드가 깨어나 종료
+    std::mutex ReloadMutex; // Start/Stop 끼리만
 };
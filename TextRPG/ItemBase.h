@@ -1,6 +1,8 @@
 ﻿#pragma once
 
+#include<cctype>
 #include<string>
+#include<string_view>
 
 enum ItemType
 {
@@ -10,9 +12,21 @@ enum ItemType
 
 struct ItemBase
 {
-	int idx;
-	ItemType type;
+	int idx = 0;
+	ItemType type = IT_NONE;
 	std::string name;
 	std::string effect;
-	int value;
-};
\ No newline at end of file
+	int value = 0;
+};
+
+// "Consume"(대소문자 무시) → IT_CONSUME, 나머지는 IT_NONE
+inline ItemType ParseItemType(std::string_view sRaw)
+{
+	static const char consume[] = "consume";
+	if (sRaw.size() != sizeof(consume) - 1)
+		return IT_NONE;
+	for (size_t i = 0; i < sRaw.size(); ++i)
+		if (std::tolower((unsigned char)sRaw[i]) != consume[i])
+			return IT_NONE;
+	return IT_CONSUME;
+}
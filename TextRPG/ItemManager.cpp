@@ -1,19 +1,49 @@
 ﻿#include "ItemManager.h"
 #include "DataManager.h"
 
+#include <iostream>
+
 void ItemManager::Init()
 {
-	ItemDatas.clear();
+	ItemDatas.Clear();
+	ItemIdxIndex.Clear();
+	Source.reset();
 	DataManager& DM = DataManager::Instance();
 	if (DM.Initialize() == false)
 		return;
 
-	ItemDatas = DM.TakeItems();
+	Rebuild(DM.GetItems());
+}
+
+bool ItemManager::Refresh()
+{
+	return Refresh(DataManager::Instance().GetItems());
+}
+
+bool ItemManager::Refresh(std::shared_ptr<const ItemTable> items)
+{
+	if (items == nullptr || items == Source)
+		return false;
+	Rebuild(std::move(items));
+	return true;
+}
+
+void ItemManager::Rebuild(std::shared_ptr<const ItemTable> items)
+{
+	// 스냅샷의 행(ItemBase)을 컬럼 저장소로 옮긴다
+	ItemDatas.Clear();
+	ItemDatas.Reserve(items->size());
+	for (const ItemBase& item : *items)
+		ItemDatas.Add(item);
+
+	ItemIdxIndex.Build(ItemDatas.IdxColumn());
+	Source = std::move(items);
+	++Version;
 }
 
 void ItemManager::PrintAllItems()
 {
-	for (auto& item : ItemDatas)
+	for (const auto& item : ItemDatas)
 	{
 		std::cout << "==========================" << '\n';
 		std::cout << "아이템 이름 : " << item.name << '\n';
@@ -22,3 +52,25 @@ void ItemManager::PrintAllItems()
 		std::cout << "아이템 인덱스 : " << item.idx << '\n';
 	}
 }
+
+std::optional<ItemRef> ItemManager::FindItem(int idx) const
+{
+	int32_t row = ItemIdxIndex.Find(idx);
+	if (row < 0)
+		return std::nullopt;
+	return ItemDatas.At(static_cast<size_t>(row));
+}
+
+std::vector<size_t> ItemManager::FindItems(ItemType type, int minValue) const
+{
+	const std::vector<ItemType>& types = ItemDatas.TypeColumn();
+	const std::vector<int>& values = ItemDatas.ValueColumn();
+
+	std::vector<size_t> rows;
+	for (size_t r = 0; r < types.size(); ++r)
+	{
+		if (types[r] == type && values[r] > minValue)
+			rows.push_back(r);
+	}
+	return rows;
+}
\ No newline at end of file
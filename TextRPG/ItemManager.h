@@ -2,17 +2,50 @@
 
 #include <vector>
 #include <string>
+#include <optional>
+#include <memory>
+#include <cstdint>
 
-#include"ItemBase.h"
+#include"ItemStore.h"
+#include "DataManager.h"
 
+// 저장소(StringPool)와 그 안을 가리키는 ItemRef 를 내주므로 복사는 막는다
 class ItemManager
 {
 public:
+    ItemManager() = default;
+    ItemManager(const ItemManager&) = delete;
+    ItemManager& operator=(const ItemManager&) = delete;
+    ItemManager(ItemManager&&) = default;
+    ItemManager& operator=(ItemManager&&) = default;
+
     void Init();
 
+    // DataManager 에 새 스냅샷이 게시됐으면(핫 리로드) 저장소와 인덱스를 다시 만든다. 다시 만들었으면 true.
+    // 게임 스레드에서 명령/프레임 사이에 부른다. 그 전에 받아 둔 ItemRef 는 더 이상 유효하지 않다.
+    bool Refresh();
+    // 주어진 스냅샷으로 다시 만든다(지금 것과 같으면 false). Refresh() 는 DataManager 의 스냅샷으로 이것을 부른다.
+    bool Refresh(std::shared_ptr<const ItemTable> items);
+    uint64_t GetVersion() const { return Version; } // 다시 만들 때마다 +1 (조인해 둔 쪽이 비교용으로)
+
     void PrintAllItems();
 
+    size_t GetItemCount() const { return ItemDatas.Size(); }
+    ItemRef GetItem(size_t row) const { return ItemDatas.At(row); }
+
+    // Idx 로 찾기 (O(1), Init 에서 만든 인덱스 사용). 없으면 nullopt
+    std::optional<ItemRef> FindItem(int idx) const;
+    int32_t FindItemRow(int idx) const { return ItemIdxIndex.Find(idx); } // 없으면 -1
+
+    // type 이 같고 value 가 minValue 보다 큰 아이템들의 행 번호 (정수 컬럼만 훑음)
+    std::vector<size_t> FindItems(ItemType type, int minValue) const;
+
 private:
-    std::vector<ItemBase> ItemDatas;
+    void Rebuild(std::shared_ptr<const ItemTable> items);
+
+    std::shared_ptr<const ItemTable> Source; // 지금 저장소를 만든 스냅샷
+    uint64_t Version = 0;
+    ItemStore ItemDatas;
+    IdIndex ItemIdxIndex;
 };
 
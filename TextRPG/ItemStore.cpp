@@ -0,0 +1,134 @@
+﻿#include "ItemStore.h"
+#include <algorithm>
+
+// ---------- StringPool ----------
+uint32_t StringPool::Intern(std::string_view s)
+{
+	auto it = ids.find(s);
+	if (it != ids.end())
+		return it->second;
+
+	uint32_t id = static_cast<uint32_t>(strings.size());
+	strings.emplace_back(s);
+	ids.emplace(std::string_view(strings.back()), id);
+	return id;
+}
+
+void StringPool::Clear()
+{
+	ids.clear();
+	strings.clear();
+}
+
+// ---------- ItemStore ----------
+void ItemStore::Clear()
+{
+	idx.clear();
+	type.clear();
+	value.clear();
+	nameId.clear();
+	effectId.clear();
+	strings.Clear();
+}
+
+void ItemStore::Reserve(size_t n)
+{
+	idx.reserve(n);
+	type.reserve(n);
+	value.reserve(n);
+	nameId.reserve(n);
+	effectId.reserve(n);
+}
+
+void ItemStore::Add(const ItemBase& item)
+{
+	idx.push_back(item.idx);
+	type.push_back(item.type);
+	value.push_back(item.value);
+	nameId.push_back(strings.Intern(item.name));
+	effectId.push_back(strings.Intern(item.effect));
+}
+
+ItemRef ItemStore::At(size_t row) const
+{
+	return ItemRef{ idx[row], type[row], strings.Get(nameId[row]), strings.Get(effectId[row]), value[row] };
+}
+
+// ---------- IdIndex ----------
+void IdIndex::Clear()
+{
+	dense = true;
+	minId = 0;
+	slots.clear();
+	keys.clear();
+	mask = 0;
+	shift = 32;
+}
+
+void IdIndex::Build(const std::vector<int>& ids)
+{
+	Clear();
+	if (ids.empty())
+		return;
+
+	auto mm = std::minmax_element(ids.begin(), ids.end());
+	int64_t range = static_cast<int64_t>(*mm.second) - *mm.first + 1;
+	dense = range <= static_cast<int64_t>(ids.size()) * 2 + 64;
+
+	if (dense)
+	{
+		minId = *mm.first;
+		slots.assign(static_cast<size_t>(range), -1);
+		for (size_t r = 0; r < ids.size(); ++r)
+		{
+			int32_t& slot = slots[static_cast<size_t>(ids[r] - minId)];
+			if (slot < 0)
+				slot = static_cast<int32_t>(r);
+		}
+		return;
+	}
+
+	// 버킷 수: 개수의 2배 이상인 2의 거듭제곱
+	uint32_t bits = 1;
+	while ((size_t(1) << bits) < ids.size() * 2)
+		++bits;
+	mask = (1u << bits) - 1;
+	shift = 32 - bits;
+	slots.assign(size_t(mask) + 1, -1);
+	keys.assign(size_t(mask) + 1, 0);
+	for (size_t r = 0; r < ids.size(); ++r)
+	{
+		int id = ids[r];
+		uint32_t b = Hash(id) >> shift;
+		while (slots[b] >= 0 && keys[b] != id)
+			b = (b + 1) & mask;
+		if (slots[b] < 0)
+		{
+			slots[b] = static_cast<int32_t>(r);
+			keys[b] = id;
+		}
+	}
+}
+
+int32_t IdIndex::Find(int id) const
+{
+	if (slots.empty())
+		return -1;
+
+	if (dense)
+	{
+		int64_t off = static_cast<int64_t>(id) - minId;
+		if (off < 0 || off >= static_cast<int64_t>(slots.size()))
+			return -1;
+		return slots[static_cast<size_t>(off)];
+	}
+
+	uint32_t b = Hash(id) >> shift;
+	while (slots[b] >= 0)
+	{
+		if (keys[b] == id)
+			return slots[b];
+		b = (b + 1) & mask;
+	}
+	return -1;
+}
\ No newline at end of file
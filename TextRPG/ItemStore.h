@@ -0,0 +1,112 @@
+﻿#pragma once
+// ItemStore.h : 아이템 카탈로그를 컬럼(SoA)으로 저장
+// idx/type/value 는 각각 연속 배열이라 "소모품 중 value > X" 같은 스캔은 정수 배열만 훑는다.
+// name/effect 는 StringPool 의 ID 로 들고 있어서 "Heal" 같은 반복 문자열은 한 번만 저장된다.
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ItemBase.h"
+
+// 같은 문자열은 같은 ID. 풀이 살아 있는 동안 문자열 주소는 바뀌지 않는다.
+// 복사하면 ids 의 key 가 원본 풀을 가리키게 되므로 복사는 막고 이동만 둔다
+// (deque 는 이동해도 원소 블록을 그대로 넘겨서 key 가 계속 유효).
+class StringPool {
+public:
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+    StringPool(StringPool&&) = default;
+    StringPool& operator=(StringPool&&) = default;
+
+    uint32_t Intern(std::string_view s);
+    std::string_view Get(uint32_t id) const { return strings[id]; }
+    size_t Size() const { return strings.size(); }
+    void Clear();
+
+private:
+    std::deque<std::string> strings;                    // push_back 해도 기존 원소가 움직이지 않음
+    std::unordered_map<std::string_view, uint32_t> ids; // key 는 strings 안을 가리킨다
+};
+
+// 아이템 한 개를 읽기 전용으로 본 값 (name/effect 는 풀 안을 가리킴)
+struct ItemRef {
+    int idx;
+    ItemType type;
+    std::string_view name;
+    std::string_view effect;
+    int value;
+};
+
+// StringPool 을 들고 있어서 이동만 된다
+class ItemStore {
+public:
+    ItemStore() = default;
+    ItemStore(const ItemStore&) = delete;
+    ItemStore& operator=(const ItemStore&) = delete;
+    ItemStore(ItemStore&&) = default;
+    ItemStore& operator=(ItemStore&&) = default;
+
+    void Clear();
+    void Reserve(size_t n);
+    void Add(const ItemBase& item);
+
+    size_t Size() const { return idx.size(); }
+    ItemRef At(size_t row) const;
+
+    // 스캔용 컬럼 직접 접근
+    const std::vector<int>& IdxColumn() const { return idx; }
+    const std::vector<ItemType>& TypeColumn() const { return type; }
+    const std::vector<int>& ValueColumn() const { return value; }
+
+    // for (const auto& item : store) — 원소는 ItemRef 값
+    class Iterator {
+    public:
+        Iterator(const ItemStore* s, size_t r) : store(s), row(r) {}
+        ItemRef operator*() const { return store->At(row); }
+        Iterator& operator++() { ++row; return *this; }
+        bool operator!=(const Iterator& o) const { return row != o.row; }
+    private:
+        const ItemStore* store;
+        size_t row;
+    };
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, Size()); }
+
+private:
+    std::vector<int> idx;
+    std::vector<ItemType> type;
+    std::vector<int> value;
+    std::vector<uint32_t> nameId;
+    std::vector<uint32_t> effectId;
+    StringPool strings;
+};
+
+// 정수 id → 위치 인덱스. 한 번 만들고 이후 조회는 O(1).
+// 아이템 전용이 아니라 공용이다: ItemManager 는 Idx → 행, ShopManager 는 ShopId / ItemIdx → 구간 번호에 쓴다.
+// - id 범위가 촘촘하면(범위 <= 개수 * 2 + 64) min 기준 직접 매핑 배열
+// - 듬성하면 open addressing 해시(선형 탐사, 적재율 50% 이하)
+// 같은 id 가 여러 번 나오면 처음 위치가 이긴다.
+class IdIndex {
+public:
+    void Build(const std::vector<int>& ids);
+    void Clear();
+
+    // 없으면 -1
+    int32_t Find(int id) const;
+
+    bool IsDense() const { return dense; }
+
+private:
+    static uint32_t Hash(int id) { return static_cast<uint32_t>(id) * 2654435769u; } // 피보나치 해싱
+
+    bool dense = true;
+    int minId = 0;
+    std::vector<int32_t> slots; // dense: id - minId 자리의 위치, hash: 버킷의 위치(-1 = 빈 칸)
+    std::vector<int> keys;      // hash 버킷의 id
+    uint32_t mask = 0;
+    uint32_t shift = 32;
+};
@@ -5,7 +5,12 @@
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <charconv>
 #include <stdexcept>
 
 #ifdef _WIN32
@@ -20,6 +25,8 @@ struct JsonValue {
 	enum Type { Null, Bool, Number, String, Array, Object };
 	Type type = Null;
 	double number = 0.0;
+	int64_t integer = 0;      // isInteger 면 정확한 정수 값
+	bool isInteger = false;   // 소수점/지수 없이 int64 범위에 들어오는 숫자
 	bool boolean = false;
 	std::string str;
 	std::vector<JsonValue> arr;
@@ -28,6 +35,7 @@ struct JsonValue {
 	static JsonValue makeNull() { return JsonValue(); }
 	static JsonValue makeBool(bool b) { JsonValue v; v.type = Bool; v.boolean = b; return v; }
 	static JsonValue makeNumber(double d) { JsonValue v; v.type = Number; v.number = d; return v; }
+	static JsonValue makeInteger(int64_t i) { JsonValue v; v.type = Number; v.number = (double)i; v.integer = i; v.isInteger = true; return v; }
 	static JsonValue makeString(const std::string& s) { JsonValue v; v.type = String; v.str = s; return v; }
 	static JsonValue makeArray() { JsonValue v; v.type = Array; return v; }
 	static JsonValue makeObject() { JsonValue v; v.type = Object; return v; }
@@ -41,14 +49,139 @@ struct JsonValue {
 		const JsonValue* p = get(key); return (p && p->type == String) ? p->str : def;
 	}
 	int getInt(const std::string& key, int def = 0) const {
-		const JsonValue* p = get(key); return (p && p->type == Number) ? (int)(p->number) : def;
+		const JsonValue* p = get(key);
+		if (!p || p->type != Number) return def;
+		return p->isInteger ? (int)p->integer : (int)p->number;
 	}
 };
 
+// SAX 이벤트로 넘기는 스칼라 값 (str 은 콜백 안에서만 유효)
+struct JsonScalar {
+	JsonValue::Type type = JsonValue::Null;
+	double number = 0.0;
+	int64_t integer = 0;
+	bool isInteger = false;
+	bool boolean = false;
+	std::string_view str;
+};
+
+// --------- 토큰 헬퍼 (DOM / SAX 공용, 할당 없음) ----------
+// 숫자 토큰. 소수점/지수가 없고 int64 범위면 integer 에 정확한 값.
+struct JsonNumber {
+	double number = 0.0;
+	int64_t integer = 0;
+	bool isInteger = false;
+};
+
+// p[i] 부터 JSON 숫자 하나를 읽고 i 를 숫자 뒤로 옮긴다.
+static inline void jsonScanNumber(const char* p, size_t& i, size_t n, JsonNumber& out) {
+	auto digits = [&]() { size_t b = i; while (i < n && p[i] >= '0' && p[i] <= '9') ++i; return i > b; };
+	size_t start = i;
+	bool integral = true;
+	if (i < n && p[i] == '-') ++i;
+	if (i < n && p[i] == '0') ++i;
+	else if (!digits()) throw std::runtime_error("bad number");
+	if (i < n && p[i] == '.') {
+		++i; integral = false;
+		if (!digits()) throw std::runtime_error("bad number frac");
+	}
+	if (i < n && (p[i] == 'e' || p[i] == 'E')) {
+		++i; integral = false;
+		if (i < n && (p[i] == '+' || p[i] == '-')) ++i;
+		if (!digits()) throw std::runtime_error("bad number exp");
+	}
+
+	// 정수 fast path: 문법은 위에서 확인했으니 from_chars 는 범위만 본다
+	if (integral) {
+		std::from_chars_result r = std::from_chars(p + start, p + i, out.integer);
+		if (r.ec == std::errc()) {
+			out.number = (double)out.integer;
+			out.isInteger = true;
+			return;
+		}
+	}
+	out.isInteger = false;
+	std::from_chars_result r = std::from_chars(p + start, p + i, out.number);
+	if (r.ec == std::errc::result_out_of_range) // 1e999 같은 값(드묾): strtod 처럼 inf/0 으로
+		out.number = std::strtod(std::string(p + start, i - start).c_str(), nullptr);
+}
+
+// p[i, n) 에서 첫 '"' 또는 '\\' 위치(없으면 n). 8바이트씩 한 번에 본다(SWAR).
+static inline size_t jsonFindQuoteOrBackslash(const char* p, size_t i, size_t n) {
+	const uint64_t ones = 0x0101010101010101ull, highs = 0x8080808080808080ull;
+	for (; i + 8 <= n; i += 8) {
+		uint64_t w;
+		std::memcpy(&w, p + i, 8);
+		uint64_t q = w ^ (ones * '"'), b = w ^ (ones * '\\'); // 해당 바이트가 0 이 된다
+		if (((q - ones) & ~q & highs) | ((b - ones) & ~b & highs)) break;
+	}
+	while (i < n && p[i] != '"' && p[i] != '\\') ++i;
+	return i;
+}
+
+static inline uint32_t jsonReadHex4(const char* p, size_t& i, size_t n) {
+	if (i + 4 > n) throw std::runtime_error("bad \\u escape");
+	uint32_t v = 0;
+	for (int k = 0; k < 4; ++k) {
+		char h = p[i++];
+		v <<= 4;
+		if (h >= '0' && h <= '9') v |= h - '0';
+		else if (h >= 'a' && h <= 'f') v |= h - 'a' + 10;
+		else if (h >= 'A' && h <= 'F') v |= h - 'A' + 10;
+		else throw std::runtime_error("bad \\u escape");
+	}
+	return v;
+}
+
+// "\\u" 바로 다음 위치에서 XXXX 를 읽어 코드 포인트로. 서로게이트 쌍은 뒤의 \\uXXXX 까지 읽는다.
+static inline uint32_t jsonReadUnicodeEscape(const char* p, size_t& i, size_t n) {
+	uint32_t cp = jsonReadHex4(p, i, n);
+	if (cp >= 0xD800 && cp <= 0xDBFF) {
+		if (i + 2 > n || p[i] != '\\' || p[i + 1] != 'u') throw std::runtime_error("bad \\u surrogate");
+		i += 2;
+		uint32_t lo = jsonReadHex4(p, i, n);
+		if (lo < 0xDC00 || lo > 0xDFFF) throw std::runtime_error("bad \\u surrogate");
+		cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+	}
+	else if (cp >= 0xDC00 && cp <= 0xDFFF) throw std::runtime_error("bad \\u surrogate");
+	return cp;
+}
+
+// 코드 포인트를 UTF-8 로 out 에 쓰고 바이트 수를 돌려준다(최대 4).
+static inline size_t jsonEncodeUtf8(uint32_t cp, char* out) {
+	if (cp < 0x80) { out[0] = (char)cp; return 1; }
+	if (cp < 0x800) { out[0] = (char)(0xC0 | (cp >> 6)); out[1] = (char)(0x80 | (cp & 0x3F)); return 2; }
+	if (cp < 0x10000) {
+		out[0] = (char)(0xE0 | (cp >> 12)); out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+		out[2] = (char)(0x80 | (cp & 0x3F)); return 3;
+	}
+	out[0] = (char)(0xF0 | (cp >> 18)); out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+	out[2] = (char)(0x80 | ((cp >> 6) & 0x3F)); out[3] = (char)(0x80 | (cp & 0x3F)); return 4;
+}
+
+// '\\' 다음 위치의 escape 하나를 풀어 out 에 쓰고 바이트 수를 돌려준다(최대 4).
+static inline size_t jsonDecodeEscape(const char* p, size_t& i, size_t n, char* out) {
+	if (i >= n) throw std::runtime_error("bad escape");
+	char e = p[i++];
+	switch (e) {
+	case '"': *out = '"'; return 1;
+	case '\\': *out = '\\'; return 1;
+	case '/': *out = '/'; return 1;
+	case 'b': *out = '\b'; return 1;
+	case 'f': *out = '\f'; return 1;
+	case 'n': *out = '\n'; return 1;
+	case 'r': *out = '\r'; return 1;
+	case 't': *out = '\t'; return 1;
+	case 'u': return jsonEncodeUtf8(jsonReadUnicodeEscape(p, i, n), out);
+	default: throw std::runtime_error("bad escape");
+	}
+}
+
 // --------- Minimal JSON Parser (subset) ----------
+// src 는 파서보다 오래 살아 있어야 한다(문자열 view 가 src 를 가리킨다). NDJSON 은 줄마다 view 로 넘긴다.
 struct JsonParser {
-	const std::string& s; size_t i, n;
-	explicit JsonParser(const std::string& src) : s(src), i(0), n(src.size()) {}
+	std::string_view s; size_t i, n;
+	explicit JsonParser(std::string_view src) : s(src), i(0), n(src.size()) {}
 
 	void skipWs() { while (i < n && std::isspace((unsigned char)s[i])) ++i; }
 	bool match(char c) { skipWs(); if (i < n && s[i] == c) { ++i; return true; } return false; }
@@ -79,7 +212,7 @@ struct JsonParser {
 		if (match('}')) return v;
 		while (true) {
 			skipWs(); if (s[i] != '"') throw std::runtime_error("object key must be string");
-			std::string key = parseString().str;
+			std::string key(scanString());
 			skipWs(); expect(':');
 			JsonValue val = parseValue();
 			v.obj.insert(std::make_pair(key, val));
@@ -104,63 +237,115 @@ struct JsonParser {
 		return v;
 	}
 
-	JsonValue parseString() {
-		expect('"');
-		std::string out; out.reserve(32);
-		while (i < n) {
-			char c = s[i++];
-			if (c == '"') break;
-			if (c == '\\') {
-				if (i >= n) throw std::runtime_error("bad escape");
-				char e = s[i++];
-				switch (e) {
-				case '"': out.push_back('"'); break;
-				case '\\': out.push_back('\\'); break;
-				case '/': out.push_back('/'); break;
-				case 'b': out.push_back('\b'); break;
-				case 'f': out.push_back('\f'); break;
-				case 'n': out.push_back('\n'); break;
-				case 'r': out.push_back('\r'); break;
-				case 't': out.push_back('\t'); break;
-				default: throw std::runtime_error("unsupported escape (\\uXXXX omitted)");
-				}
-			}
-			else {
-				out.push_back(c);
-			}
-		}
-		return JsonValue::makeString(out);
+	JsonValue parseString() { return JsonValue::makeString(std::string(scanString())); }
+
+	JsonValue parseBool() { return JsonValue::makeBool(scanBool()); }
+	JsonValue parseNull() { scanNull(); return JsonValue::makeNull(); }
+	JsonValue parseNumber() {
+		JsonNumber num = scanNumber();
+		return num.isInteger ? JsonValue::makeInteger(num.integer) : JsonValue::makeNumber(num.number);
 	}
 
-	JsonValue parseBool() {
-		if (i + 3 < n && s.compare(i, 4, "true") == 0) { i += 4; return JsonValue::makeBool(true); }
-		if (i + 4 < n && s.compare(i, 5, "false") == 0) { i += 5; return JsonValue::makeBool(false); }
+	// --------- 토큰 스캔 (DOM/SAX 공용) ----------
+	bool scanBool() {
+		if (s.compare(i, 4, "true") == 0) { i += 4; return true; }
+		if (s.compare(i, 5, "false") == 0) { i += 5; return false; }
 		throw std::runtime_error("bad boolean");
 	}
 
-	JsonValue parseNull() {
-		if (i + 3 < n && s.compare(i, 4, "null") == 0) { i += 4; return JsonValue::makeNull(); }
+	void scanNull() {
+		if (s.compare(i, 4, "null") == 0) { i += 4; return; }
 		throw std::runtime_error("bad null");
 	}
 
-	JsonValue parseNumber() {
+	// s[i] == '"'. escape 가 없으면 원문을 가리키는 view, 있으면 scratch 에 풀어서 그 view.
+	// (scratch 는 다음 scanString 호출까지만 유효)
+	std::string_view scanString() {
+		expect('"');
+		const char* p = s.data();
 		size_t start = i;
-		if (s[i] == '-') ++i;
-		if (i < n && s[i] == '0') { ++i; }
-		else {
-			if (i >= n || !std::isdigit((unsigned char)s[i])) throw std::runtime_error("bad number");
-			while (i < n && std::isdigit((unsigned char)s[i])) ++i;
+		i = jsonFindQuoteOrBackslash(p, i, n);
+		if (i >= n) throw std::runtime_error("unterminated string");
+		if (p[i] == '"') return std::string_view(p + start, (i++) - start);
+
+		// escape 가 있으면 escape 사이의 깨끗한 구간을 통째로 붙여 가며 푼다
+		scratch.assign(p + start, i - start);
+		while (true) {
+			char buf[4];
+			++i; // '\\'
+			scratch.append(buf, jsonDecodeEscape(p, i, n, buf));
+			size_t j = jsonFindQuoteOrBackslash(p, i, n);
+			scratch.append(p + i, j - i);
+			i = j;
+			if (i >= n) throw std::runtime_error("unterminated string");
+			if (p[i] == '"') { ++i; return scratch; }
+		}
+	}
+
+	JsonNumber scanNumber() {
+		JsonNumber num;
+		jsonScanNumber(s.data(), i, n, num);
+		return num;
+	}
+
+	// --------- SAX ----------
+	// 트리를 만들지 않고 값을 훑으면서 handler 를 부른다.
+	//   startArray() / endArray() / startObject() / endObject()
+	//   key(std::string_view) / value(const JsonScalar&)
+	// 문자열 view 는 콜백 안에서만 유효하다.
+	template <class Handler>
+	void parseEvents(Handler& h) {
+		skipWs(); parseEventValue(h); skipWs();
+		if (i != n) throw std::runtime_error("extra characters after JSON");
+	}
+
+	template <class Handler>
+	void parseEventValue(Handler& h) {
+		skipWs(); if (i >= n) throw std::runtime_error("unexpected end");
+		char c = s[i];
+		JsonScalar v;
+		if (c == '{') {
+			expect('{');
+			h.startObject();
+			if (!match('}')) {
+				while (true) {
+					skipWs(); if (i >= n || s[i] != '"') throw std::runtime_error("object key must be string");
+					h.key(scanString());
+					expect(':');
+					parseEventValue(h);
+					if (match('}')) break;
+					expect(',');
+				}
+			}
+			h.endObject();
+			return;
 		}
-		if (i < n && s[i] == '.') {
-			++i; if (i >= n || !std::isdigit((unsigned char)s[i])) throw std::runtime_error("bad number frac");
-			while (i < n && std::isdigit((unsigned char)s[i])) ++i;
+		if (c == '[') {
+			expect('[');
+			h.startArray();
+			if (!match(']')) {
+				while (true) {
+					parseEventValue(h);
+					if (match(']')) break;
+					expect(',');
+				}
+			}
+			h.endArray();
+			return;
 		}
-		if (i < n && (s[i] == 'e' || s[i] == 'E')) {
-			++i; if (i < n && (s[i] == '+' || s[i] == '-')) ++i;
-			if (i >= n || !std::isdigit((unsigned char)s[i])) throw std::runtime_error("bad number exp");
-			while (i < n && std::isdigit((unsigned char)s[i])) ++i;
+		if (c == '"') { v.type = JsonValue::String; v.str = scanString(); }
+		else if (c == 't' || c == 'f') { v.type = JsonValue::Bool; v.boolean = scanBool(); }
+		else if (c == 'n') { scanNull(); }
+		else if (c == '-' || std::isdigit((unsigned char)c)) {
+			JsonNumber num = scanNumber();
+			v.type = JsonValue::Number;
+			v.number = num.number;
+			v.integer = num.integer;
+			v.isInteger = num.isInteger;
 		}
-		double val = std::strtod(s.substr(start, i - start).c_str(), nullptr);
-		return JsonValue::makeNumber(val);
+		else throw std::runtime_error(std::string("unexpected char: ") + c);
+		h.value(v);
 	}
+
+	std::string scratch; // escape 가 있는 문자열을 풀어 두는 곳
 };
@@ -1,12 +1,63 @@
 ﻿#include <iostream>
+#include <string>
 #include "DataManager.h"
 #include "ItemManager.h"
+#include "ShopManager.h"
 
 #ifdef _WIN32
 #include <windows.h>
 #endif
 
-int main()
+// --hot-reload 로 켜면 Resources/output 을 감시하면서 명령을 받는다.
+// 명령마다 먼저 Refresh 해서, 그 사이 바뀐 테이블이 조회에 바로 보인다.
+//   item <idx> : 아이템 하나 출력
+//   shop <id>  : 상점 하나 출력
+//   quit
+static void RunHotReloadConsole(ItemManager& itemMgr, ShopManager& shopMgr)
+{
+    DataManager& DM = DataManager::Instance();
+    if (DM.StartHotReload() == false)
+    {
+        std::cout << "HotReload: not supported on this platform" << '\n';
+        return;
+    }
+
+    std::string cmd;
+    while (std::cout << "> " << std::flush, std::cin >> cmd)
+    {
+        if (cmd == "quit")
+            break;
+
+        itemMgr.Refresh();
+        shopMgr.Refresh(itemMgr);
+
+        int key = 0;
+        if (cmd == "item" && std::cin >> key)
+        {
+            std::optional<ItemRef> item = itemMgr.FindItem(key);
+            if (item)
+                std::cout << item->idx << " " << item->name << " : " << item->effect << " " << item->value << '\n';
+            else
+                std::cout << "아이템 " << key << " 없음" << '\n';
+        }
+        else if (cmd == "shop" && std::cin >> key)
+        {
+            for (const ShopEntry& e : shopMgr.GetShop(key))
+            {
+                std::cout << (e.itemRow >= 0 ? e.item.name : std::string_view("(알 수 없는 아이템)"))
+                    << " : " << e.price << " (재고 " << e.stock << ")" << '\n';
+            }
+        }
+        else
+        {
+            std::cin.clear();
+            std::cout << "item <idx> | shop <id> | quit" << '\n';
+        }
+    }
+    DM.StopHotReload();
+}
+
+int main(int argc, char* argv[])
 {
 #ifdef _WIN32
     // 콘솔 입출력 코드페이지를 UTF-8로
@@ -18,4 +69,11 @@ int main()
     itemMgr.Init();
     itemMgr.PrintAllItems();
 
+    ShopManager shopMgr;
+    shopMgr.Init(itemMgr);
+    shopMgr.PrintAllShops();
+
+    if (argc > 1 && std::string(argv[1]) == "--hot-reload")
+        RunHotReloadConsole(itemMgr, shopMgr);
+
 }
\ No newline at end of file
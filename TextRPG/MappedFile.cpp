@@ -0,0 +1,100 @@
+﻿#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ---------- Open / Close ----------
+bool MappedFile::Open(const std::string& pathUtf8)
+{
+	Close();
+	error.clear();
+
+#ifdef _WIN32
+	int wlen = MultiByteToWideChar(CP_UTF8, 0, pathUtf8.c_str(), -1, nullptr, 0);
+	std::wstring wpath(wlen > 0 ? wlen - 1 : 0, L'\0');
+	if (wlen > 1)
+		MultiByteToWideChar(CP_UTF8, 0, pathUtf8.c_str(), -1, &wpath[0], wlen);
+
+	HANDLE f = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (f == INVALID_HANDLE_VALUE)
+		return Fail("failed to open: " + pathUtf8);
+	hFile = f;
+
+	LARGE_INTEGER sz;
+	if (!GetFileSizeEx(f, &sz))
+		return Fail("failed to open: " + pathUtf8);
+	if (sz.QuadPart > 0) // 크기 0 은 매핑할 수 없다
+	{
+		HANDLE m = CreateFileMappingW(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!m)
+			return Fail("CreateFileMapping failed: " + pathUtf8);
+		hMapping = m;
+
+		const void* view = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+		if (!view)
+			return Fail("MapViewOfFile failed: " + pathUtf8);
+		base = static_cast<const unsigned char*>(view);
+		size = static_cast<uint64_t>(sz.QuadPart);
+	}
+#else
+	int fd = ::open(pathUtf8.c_str(), O_RDONLY);
+	if (fd < 0)
+		return Fail("failed to open: " + pathUtf8);
+
+	struct stat st;
+	if (fstat(fd, &st) != 0)
+	{
+		::close(fd);
+		return Fail("failed to open: " + pathUtf8);
+	}
+	if (st.st_size > 0) // 크기 0 은 매핑할 수 없다
+	{
+		void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		if (view == MAP_FAILED)
+		{
+			::close(fd);
+			return Fail("mmap failed: " + pathUtf8);
+		}
+		base = static_cast<const unsigned char*>(view);
+		size = static_cast<uint64_t>(st.st_size);
+	}
+	::close(fd); // 매핑은 fd 를 닫아도 유지된다
+#endif
+
+	open = true;
+	return true;
+}
+
+void MappedFile::Close()
+{
+#ifdef _WIN32
+	if (base)
+		UnmapViewOfFile(base);
+	if (hMapping)
+		CloseHandle(static_cast<HANDLE>(hMapping));
+	if (hFile)
+		CloseHandle(static_cast<HANDLE>(hFile));
+	hMapping = nullptr;
+	hFile = nullptr;
+#else
+	if (base)
+		munmap(const_cast<unsigned char*>(base), static_cast<size_t>(size));
+#endif
+	base = nullptr;
+	size = 0;
+	open = false;
+}
+
+bool MappedFile::Fail(const std::string& why)
+{
+	Close();
+	error = why;
+	return false;
+}
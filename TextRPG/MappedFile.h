@@ -0,0 +1,38 @@
+﻿// MappedFile.h : 읽기 전용 파일 매핑(Windows MapViewOfFile / POSIX mmap)
+// 파일을 통째로 메모리에 매핑해서, 읽기/복사 없이 바로 훑는다(BinTable, NDJSON 로더).
+// Data() 는 Close(또는 다른 Open) 전까지만 유효하다.
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 없거나 매핑에 실패하면 false, 이유는 LastError(). 빈 파일은 성공(Size() == 0, Data() == nullptr).
+    bool Open(const std::string& pathUtf8);
+    void Close();
+
+    bool IsOpen() const { return open; }
+    const unsigned char* Data() const { return base; }
+    uint64_t Size() const { return size; }
+    std::string_view View() const { return std::string_view(reinterpret_cast<const char*>(base), static_cast<size_t>(size)); }
+    const std::string& LastError() const { return error; }
+
+private:
+    bool Fail(const std::string& why);
+
+    const unsigned char* base = nullptr;
+    uint64_t size = 0;
+    bool open = false;
+    std::string error;
+
+#ifdef _WIN32
+    void* hFile = nullptr;
+    void* hMapping = nullptr;
+#endif
+};
@@ -0,0 +1,10 @@
+﻿#pragma once
+
+// Shop.json / Shop.bin 한 행 (ShopId 상점에서 ItemIdx 아이템을 Price 에 Stock 개 판매)
+struct ShopBase
+{
+	int shopId = 0;
+	int itemIdx = 0;
+	int price = 0;
+	int stock = 0;
+};
@@ -0,0 +1,115 @@
+﻿#include "ShopManager.h"
+#include "DataManager.h"
+
+#include <algorithm>
+#include <iostream>
+
+// 정렬된 keys 를 같은 값끼리 묶어서 (중복 없는 키, 구간 시작) 을 만든다
+template <class KeyOf>
+static void BuildGroups(size_t count, KeyOf keyOf, std::vector<int>& ids, std::vector<uint32_t>& begin)
+{
+	ids.clear();
+	begin.clear();
+	for (size_t e = 0; e < count; ++e)
+	{
+		if (e == 0 || keyOf(e) != keyOf(e - 1))
+		{
+			ids.push_back(keyOf(e));
+			begin.push_back(static_cast<uint32_t>(e));
+		}
+	}
+	begin.push_back(static_cast<uint32_t>(count));
+}
+
+void ShopManager::Init(const ItemManager& items)
+{
+	Entries.clear();
+	Source.reset();
+	DataManager& DM = DataManager::Instance();
+	if (DM.Initialize() == false)
+		return;
+
+	Rebuild(DM.GetShops(), items);
+}
+
+bool ShopManager::Refresh(const ItemManager& items)
+{
+	return Refresh(DataManager::Instance().GetShops(), items);
+}
+
+bool ShopManager::Refresh(std::shared_ptr<const ShopTable> shops, const ItemManager& items)
+{
+	if (shops == nullptr || (shops == Source && items.GetVersion() == ItemsVersion))
+		return false;
+	Rebuild(std::move(shops), items);
+	return true;
+}
+
+void ShopManager::Rebuild(std::shared_ptr<const ShopTable> source, const ItemManager& items)
+{
+	std::vector<ShopBase> shops = *source;
+	std::stable_sort(shops.begin(), shops.end(),
+		[](const ShopBase& a, const ShopBase& b) { return a.shopId < b.shopId; });
+
+	// 아이템 조인은 스냅샷마다 한 번만
+	Entries.clear();
+	Entries.reserve(shops.size());
+	for (const ShopBase& s : shops)
+	{
+		ShopEntry e{ s.shopId, s.itemIdx, s.price, s.stock, items.FindItemRow(s.itemIdx), ItemRef() };
+		if (e.itemRow >= 0)
+			e.item = items.GetItem(static_cast<size_t>(e.itemRow));
+		Entries.push_back(e);
+	}
+
+	// ShopId 인덱스
+	BuildGroups(Entries.size(), [&](size_t e) { return Entries[e].shopId; }, ShopIds, ShopBegin);
+	ShopIdIndex.Build(ShopIds);
+
+	// ItemIdx 인덱스
+	ByItem.resize(Entries.size());
+	for (size_t e = 0; e < Entries.size(); ++e)
+		ByItem[e] = static_cast<uint32_t>(e);
+	std::stable_sort(ByItem.begin(), ByItem.end(),
+		[&](uint32_t a, uint32_t b) { return Entries[a].itemIdx < Entries[b].itemIdx; });
+	BuildGroups(ByItem.size(), [&](size_t k) { return Entries[ByItem[k]].itemIdx; }, ItemIds, ItemBegin);
+	ItemIdIndex.Build(ItemIds);
+
+	Source = std::move(source);
+	ItemsVersion = items.GetVersion();
+}
+
+ShopSpan<ShopEntry> ShopManager::GetShop(int shopId) const
+{
+	ShopSpan<ShopEntry> span;
+	int32_t k = ShopIdIndex.Find(shopId);
+	if (k < 0)
+		return span;
+	span.first = Entries.data() + ShopBegin[k];
+	span.last = Entries.data() + ShopBegin[k + 1];
+	return span;
+}
+
+ShopSpan<uint32_t> ShopManager::FindEntriesByItem(int itemIdx) const
+{
+	ShopSpan<uint32_t> span;
+	int32_t k = ItemIdIndex.Find(itemIdx);
+	if (k < 0)
+		return span;
+	span.first = ByItem.data() + ItemBegin[k];
+	span.last = ByItem.data() + ItemBegin[k + 1];
+	return span;
+}
+
+void ShopManager::PrintAllShops() const
+{
+	for (int shopId : ShopIds)
+	{
+		std::cout << "========== 상점 " << shopId << " ==========" << '\n';
+		for (const ShopEntry& e : GetShop(shopId))
+		{
+			std::cout << (e.itemRow >= 0 ? e.item.name : std::string_view("(알 수 없는 아이템)"))
+				<< " : " << e.price << " (재고 " << e.stock << ")" << '\n';
+		}
+	}
+}
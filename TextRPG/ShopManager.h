@@ -0,0 +1,71 @@
+﻿#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ShopBase.h"
+#include "ItemManager.h"
+
+// 상점 항목 + 로드 시점에 미리 조인한 아이템
+struct ShopEntry
+{
+    int shopId;
+    int itemIdx;
+    int price;
+    int stock;
+    int32_t itemRow; // ItemManager 의 행 번호 (-1 = 없는 아이템)
+    ItemRef item;    // itemRow >= 0 일 때만 의미 있음 (ItemManager 가 살아 있는 동안 유효)
+};
+
+// 연속 구간 [first, last)
+template <class T>
+struct ShopSpan
+{
+    const T* first = nullptr;
+    const T* last = nullptr;
+
+    const T* begin() const { return first; }
+    const T* end() const { return last; }
+    size_t size() const { return static_cast<size_t>(last - first); }
+    bool empty() const { return first == last; }
+};
+
+class ShopManager
+{
+public:
+    // DataManager 의 상점 행을 받아 ShopId 순으로 정렬하고 items 와 조인한다
+    void Init(const ItemManager& items);
+
+    // 상점 스냅샷이 바뀌었거나 items 가 다시 만들어졌으면(ItemRef 가 무효) 다시 조인한다.
+    // items.Refresh() 바로 뒤에 부른다. 다시 만들었으면 true
+    bool Refresh(const ItemManager& items);
+    // 주어진 상점 스냅샷으로 같은 일을 한다. Refresh(items) 는 DataManager 의 스냅샷으로 이것을 부른다.
+    bool Refresh(std::shared_ptr<const ShopTable> shops, const ItemManager& items);
+
+    // ShopId 상점의 판매 목록 (연속 구간, 파일 순서 유지). 없으면 빈 구간
+    ShopSpan<ShopEntry> GetShop(int shopId) const;
+
+    // ItemIdx 를 파는 항목들의 번호(GetEntry 용). 없으면 빈 구간
+    ShopSpan<uint32_t> FindEntriesByItem(int itemIdx) const;
+    const ShopEntry& GetEntry(uint32_t entry) const { return Entries[entry]; }
+
+    void PrintAllShops() const;
+
+private:
+    void Rebuild(std::shared_ptr<const ShopTable> source, const ItemManager& items);
+
+    std::shared_ptr<const ShopTable> Source; // 지금 Entries 를 만든 스냅샷
+    uint64_t ItemsVersion = 0;               // 조인할 때의 ItemManager::GetVersion()
+
+    std::vector<ShopEntry> Entries;    // ShopId 순
+
+    std::vector<int> ShopIds;          // 중복 없는 ShopId (Entries 순서)
+    std::vector<uint32_t> ShopBegin;   // ShopIds[k] 의 구간 = [ShopBegin[k], ShopBegin[k + 1])
+    IdIndex ShopIdIndex;               // ShopId → k
+
+    std::vector<uint32_t> ByItem;      // ItemIdx 순으로 정렬한 Entries 번호
+    std::vector<int> ItemIds;          // 중복 없는 ItemIdx
+    std::vector<uint32_t> ItemBegin;   // ItemIds[k] 의 구간 (ByItem 안)
+    IdIndex ItemIdIndex;               // ItemIdx → k
+};
@@ -0,0 +1,63 @@
+﻿#pragma once
+// Snapshot.h : 읽기 전용 테이블 스냅샷을 락 없이 바꿔 끼우는 슬롯
+// 쓰는 쪽(리로드 스레드)이 새 테이블을 통째로 만들어 Store 하면, 읽는 쪽은 Load 로
+// 그 시점의 shared_ptr<const T> 를 받아 계속 쓴다(이전 스냅샷은 마지막 참조가 사라질 때 해제).
+//
+// 읽기는 mutex 를 잡지 않고 기다리지도 않는다(C++17 의 shared_ptr atomic_load 는 내부적으로 락을 쓴다).
+// 슬롯 두 개 + 슬롯별 읽는 중 카운터(left-right 방식):
+// - Load  : 현재 슬롯의 카운터를 올리고, 그 사이 슬롯이 바뀌지 않았으면 복사. 바뀌었으면 다시.
+// - Store : 안 쓰는 슬롯의 읽는 중 카운터가 0 이 될 때까지 기다렸다가 채우고 현재 슬롯을 바꾼다.
+//           기다리는 건 쓰는 쪽뿐이고, 쓰는 쪽끼리는 writeMutex 로 한 번에 하나.
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+template <class T>
+class SnapshotSlot {
+public:
+    SnapshotSlot() { readers[0] = 0; readers[1] = 0; }
+    SnapshotSlot(const SnapshotSlot&) = delete;
+    SnapshotSlot& operator=(const SnapshotSlot&) = delete;
+
+    // 아직 Store 한 적이 없으면 nullptr
+    std::shared_ptr<const T> Load() const
+    {
+        while (true)
+        {
+            int c = current.load();
+            readers[c].fetch_add(1);
+            if (current.load() == c)
+            {
+                std::shared_ptr<const T> copy = slots[c];
+                readers[c].fetch_sub(1);
+                return copy;
+            }
+            readers[c].fetch_sub(1); // 그 사이 Store 가 끼어듦 → 새 슬롯으로 다시
+        }
+    }
+
+    void Store(std::shared_ptr<const T> next)
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        int c = current.load();
+        int n = 1 - c;
+        WaitNoReaders(n);       // 예전에 n 을 보고 들어온 읽기가 끝나길 기다린다
+        slots[n] = std::move(next);
+        current.store(n);
+        WaitNoReaders(c);       // 이제 c 를 읽는 쪽은 새로 생기지 않는다
+        slots[c].reset();       // 이전 스냅샷은 밖에서 들고 있는 참조만 남는다
+    }
+
+private:
+    void WaitNoReaders(int s) const
+    {
+        while (readers[s].load() != 0)
+            std::this_thread::yield();
+    }
+
+    std::shared_ptr<const T> slots[2];
+    std::atomic<int> current{ 0 };
+    mutable std::atomic<int> readers[2];
+    std::mutex writeMutex;
+};
@@ -0,0 +1,258 @@
+﻿#pragma once
+// TableLoader.h : 스키마(TableSchema.h)에서 만들어지는 테이블 로더
+// - JSON : SAX 이벤트에서 키를 완전 해시로 컬럼 번호로 바꾸고, 컬럼별 setter 로 바로 채운다.
+//          setter 는 컬럼마다 인스턴스화되므로 멤버 위치/변환이 컴파일 타임에 정해진다.
+// - NDJSON : 줄 경계로 나눈 구간을 스레드마다 JSON 과 같은 SAX 로더로 읽고 줄 순서대로 잇는다.
+// - BIN  : 컬럼 위치/타입은 한 번만 찾고, 행마다 컬럼별 읽기를 펼쳐서 부른다.
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "TableSchema.h"
+#include "JsonParser.h"
+#include "BinTable.h"
+
+// ---------- 값 변환 ----------
+// 숫자면 그대로, 문자열이면 정수로 읽는다(타입 없이 변환된 예전 출력). 그 외는 0
+inline int SchemaJsonToInt(const JsonScalar& v)
+{
+	if (v.type == JsonValue::Type::Number)
+		return static_cast<int>(v.isInteger ? v.integer : static_cast<int64_t>(v.number));
+	if (v.type == JsonValue::Type::String)
+		return static_cast<int>(std::strtol(std::string(v.str).c_str(), nullptr, 10));
+	return 0;
+}
+
+template <class Schema, size_t I>
+void SchemaSetJson(typename Schema::Row& row, const JsonScalar& v)
+{
+	constexpr auto col = std::get<I>(Schema::Columns);
+	if constexpr (col.type == SchemaType::Int)
+		row.*col.member = SchemaJsonToInt(v);
+	else if constexpr (col.type == SchemaType::String)
+	{
+		if (v.type == JsonValue::Type::String)
+			row.*col.member = v.str;
+	}
+	else
+	{
+		if (v.type == JsonValue::Type::String)
+			row.*col.member = col.parse(v.str);
+	}
+}
+
+// ---------- JSON (SAX) ----------
+// 최상위 배열 안의 평평한 객체를 Row 로 채운다.
+// 모르는 키, 객체/배열 값, 배열 안의 객체가 아닌 원소는 건너뛴다.
+template <class Schema>
+class SchemaJsonLoader {
+public:
+	typedef typename Schema::Row Row;
+
+	// 최상위가 배열이 아니면 out 은 비어 있다
+	void Load(JsonParser& p, std::vector<Row>& out)
+	{
+		out.clear();
+		rows = &out;
+		depth = 0;
+		table = inRow = false;
+		field = -1;
+		p.parseEvents(*this);
+	}
+
+	// NDJSON 한 줄: 최상위 객체 하나를 out 뒤에 붙인다(객체가 아니면 건너뛴다)
+	void LoadRow(JsonParser& p, std::vector<Row>& out)
+	{
+		rows = &out;
+		depth = 1; // 최상위 배열 안의 원소처럼 읽는다
+		table = true;
+		inRow = false;
+		field = -1;
+		p.parseEvents(*this);
+	}
+
+	// ---- JsonParser 이벤트 ----
+	void startArray() { if (depth++ == 0) table = true; field = -1; }
+	void endArray() { --depth; }
+	void startObject()
+	{
+		if (depth++ == 1 && table) { current = Row(); inRow = true; }
+		field = -1;
+	}
+	void endObject()
+	{
+		if (--depth == 1 && inRow) { rows->push_back(std::move(current)); inRow = false; }
+	}
+	void key(std::string_view k) { field = (depth == 2 && inRow) ? Keys.Find(k) : -1; }
+	void value(const JsonScalar& v)
+	{
+		if (field >= 0 && depth == 2)
+			Setters[field](current, v);
+		field = -1;
+	}
+
+private:
+	typedef void (*Setter)(Row& row, const JsonScalar& v);
+
+	template <size_t... I>
+	static constexpr std::array<Setter, sizeof...(I)> MakeSetters(std::index_sequence<I...>)
+	{
+		return { { &SchemaSetJson<Schema, I>... } };
+	}
+
+	static constexpr auto Keys = MakeSchemaKeyIndex<Schema>();
+	static constexpr auto Setters = MakeSetters(std::make_index_sequence<SchemaColumnCount<Schema>()>());
+
+	std::vector<Row>* rows = nullptr;
+	Row current;
+	int field = -1; // 지금 읽는 키의 컬럼 번호 (-1 이면 건너뜀)
+	int depth = 0;
+	bool table = false;
+	bool inRow = false;
+};
+
+template <class Schema>
+void LoadSchemaJson(const std::string& text, std::vector<typename Schema::Row>& out)
+{
+	JsonParser parser(text);
+	SchemaJsonLoader<Schema> loader;
+	loader.Load(parser, out);
+}
+
+// ---------- NDJSON ----------
+// 한 줄에 객체 하나(CSVParser --format ndjson). 문자열 안의 개행은 항상 \n 으로 escape 되므로
+// '\n' 에서 바로 나눌 수 있다. 빈 줄은 건너뛰고, 깨진 줄이 있으면 예외(LoadSchemaJson 과 같음).
+
+// 구간이 이보다 작으면 나누지 않는다(스레드 비용이 더 크다)
+constexpr size_t SchemaNdjsonMinPartBytes = 1 << 20;
+
+template <class Schema>
+void LoadSchemaNdjsonLines(std::string_view text, std::vector<typename Schema::Row>& out)
+{
+	SchemaJsonLoader<Schema> loader;
+	size_t pos = 0;
+	while (pos < text.size())
+	{
+		size_t end = text.find('\n', pos);
+		if (end == std::string_view::npos)
+			end = text.size();
+		std::string_view line = text.substr(pos, end - pos);
+		pos = end + 1;
+		if (line.find_first_not_of(" \t\r") == std::string_view::npos)
+			continue;
+		JsonParser parser(line);
+		loader.LoadRow(parser, out);
+	}
+}
+
+// text 를 줄 경계에서 threads 개 이하 구간으로 나눠 동시에 읽는다(threads == 0 이면 코어 수).
+// text 는 보통 매핑한 파일 그대로라 복사가 없고, 결과는 한 스레드로 읽은 것과 같다.
+template <class Schema>
+void LoadSchemaNdjson(std::string_view text, std::vector<typename Schema::Row>& out, unsigned threads = 0)
+{
+	typedef typename Schema::Row Row;
+	if (text.size() >= 3 && text.compare(0, 3, "\xEF\xBB\xBF") == 0)
+		text.remove_prefix(3);
+	if (!threads)
+	{
+		unsigned hw = std::thread::hardware_concurrency();
+		threads = hw ? hw : 1;
+	}
+	size_t parts = std::max<size_t>(1, std::min<size_t>(threads, text.size() / SchemaNdjsonMinPartBytes));
+
+	out.clear();
+	if (parts == 1)
+	{
+		LoadSchemaNdjsonLines<Schema>(text, out);
+		return;
+	}
+
+	// 대략 균등한 위치에서 다음 줄 시작으로 민다
+	std::vector<size_t> starts(parts + 1, text.size());
+	starts[0] = 0;
+	for (size_t k = 1; k < parts; ++k)
+	{
+		size_t nl = text.find('\n', std::max(starts[k - 1], text.size() / parts * k));
+		starts[k] = (nl == std::string_view::npos) ? text.size() : nl + 1;
+	}
+
+	std::vector<std::vector<Row>> partRows(parts);
+	std::vector<std::exception_ptr> errors(parts);
+	auto work = [&](size_t k) {
+		try
+		{
+			LoadSchemaNdjsonLines<Schema>(text.substr(starts[k], starts[k + 1] - starts[k]), partRows[k]);
+		}
+		catch (...)
+		{
+			errors[k] = std::current_exception();
+		}
+		};
+	std::vector<std::thread> pool;
+	for (size_t k = 1; k < parts; ++k)
+		pool.emplace_back(work, k);
+	work(0); // 호출한 스레드도 같이 일한다
+	for (std::thread& th : pool)
+		th.join();
+	for (const std::exception_ptr& e : errors)
+		if (e)
+			std::rethrow_exception(e);
+
+	size_t total = 0;
+	for (const auto& rows : partRows)
+		total += rows.size();
+	out.reserve(total);
+	for (auto& rows : partRows)
+		out.insert(out.end(), std::make_move_iterator(rows.begin()), std::make_move_iterator(rows.end()));
+}
+
+// ---------- BIN ----------
+template <class Schema, size_t I>
+void SchemaSetBin(typename Schema::Row& row, const BinTable& table, int col, uint64_t r)
+{
+	constexpr auto c = std::get<I>(Schema::Columns);
+	if (col < 0)
+		return;
+	if constexpr (c.type == SchemaType::Int)
+		row.*c.member = table.IsNull(col, r) ? 0 : static_cast<int>(table.GetInt(col, r));
+	else if constexpr (c.type == SchemaType::String)
+		row.*c.member = std::string(table.GetString(col, r));
+	else
+		row.*c.member = c.parse(table.GetString(col, r));
+}
+
+// 컬럼이 없거나 타입이 다르면 해당 멤버는 기본값으로 둔다
+template <class Schema, size_t... I>
+void LoadSchemaBinImpl(const BinTable& table, std::vector<typename Schema::Row>& out, std::index_sequence<I...>)
+{
+	constexpr auto types = SchemaColumnTypes<Schema>();
+	constexpr auto names = SchemaColumnNames<Schema>();
+	int cols[sizeof...(I)];
+	for (size_t i = 0; i < sizeof...(I); ++i)
+	{
+		int c = table.FindColumn(names[i]);
+		BinColumnType want = (types[i] == SchemaType::Int) ? BCT_INT : BCT_STRING;
+		cols[i] = (c >= 0 && table.ColumnType(c) == want) ? c : -1;
+	}
+
+	uint64_t rows = table.RowCount();
+	out.clear();
+	out.reserve(static_cast<size_t>(rows));
+	for (uint64_t r = 0; r < rows; ++r)
+	{
+		typename Schema::Row row;
+		(SchemaSetBin<Schema, I>(row, table, cols[I], r), ...);
+		out.push_back(std::move(row));
+	}
+}
+
+template <class Schema>
+void LoadSchemaBin(const BinTable& table, std::vector<typename Schema::Row>& out)
+{
+	LoadSchemaBinImpl<Schema>(table, out, std::make_index_sequence<SchemaColumnCount<Schema>()>());
+}
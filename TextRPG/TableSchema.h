@@ -0,0 +1,157 @@
+﻿#pragma once
+// TableSchema.h : 데이터 테이블 스키마(컬럼 이름 → 구조체 멤버)를 컴파일 타임에 기술한다.
+// 스키마 하나에서 JSON/BIN 로더(TableLoader.h)와 CSVParser 의 시트 설정이 함께 나온다.
+//
+//   struct MonsterSchema {
+//       typedef MonsterBase Row;
+//       static constexpr const char* Sheet = "Monster";   // CSV/JSON 파일 이름
+//       static constexpr const char* StartCell = "A2";    // CSV 에서 데이터가 시작하는 칸
+//       static constexpr auto Columns = std::make_tuple(  // CSV 컬럼 순서대로
+//           IntColumn("Idx", &MonsterBase::idx),
+//           StringColumn("Name", &MonsterBase::name));
+//   };
+//
+// 이 헤더는 CSVParser 도 포함하므로 표준 라이브러리 말고는 의존하지 않는다.
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// 컬럼 값의 종류. Enum 은 파일에는 문자열로, 구조체에는 parse 결과로 들어간다.
+enum class SchemaType { Int, String, Enum };
+
+template <class Row, class T>
+struct SchemaColumn {
+	const char* name;
+	T Row::* member;
+	SchemaType type;
+	T (*parse)(std::string_view); // Enum 일 때만
+};
+
+template <class Row>
+constexpr SchemaColumn<Row, int> IntColumn(const char* name, int Row::* member)
+{
+	return { name, member, SchemaType::Int, nullptr };
+}
+
+template <class Row>
+constexpr SchemaColumn<Row, std::string> StringColumn(const char* name, std::string Row::* member)
+{
+	return { name, member, SchemaType::String, nullptr };
+}
+
+template <class Row, class E>
+constexpr SchemaColumn<Row, E> EnumColumn(const char* name, E Row::* member, E (*parse)(std::string_view))
+{
+	return { name, member, SchemaType::Enum, parse };
+}
+
+template <class Schema>
+constexpr size_t SchemaColumnCount()
+{
+	return std::tuple_size<std::remove_const_t<decltype(Schema::Columns)>>::value;
+}
+
+template <class Schema, size_t... I>
+constexpr std::array<std::string_view, sizeof...(I)> SchemaColumnNamesImpl(std::index_sequence<I...>)
+{
+	return { { std::string_view(std::get<I>(Schema::Columns).name)... } };
+}
+
+// 컬럼 이름들 (Columns 순서)
+template <class Schema>
+constexpr std::array<std::string_view, SchemaColumnCount<Schema>()> SchemaColumnNames()
+{
+	return SchemaColumnNamesImpl<Schema>(std::make_index_sequence<SchemaColumnCount<Schema>()>());
+}
+
+template <class Schema, size_t... I>
+constexpr std::array<SchemaType, sizeof...(I)> SchemaColumnTypesImpl(std::index_sequence<I...>)
+{
+	return { { std::get<I>(Schema::Columns).type... } };
+}
+
+template <class Schema>
+constexpr std::array<SchemaType, SchemaColumnCount<Schema>()> SchemaColumnTypes()
+{
+	return SchemaColumnTypesImpl<Schema>(std::make_index_sequence<SchemaColumnCount<Schema>()>());
+}
+
+// ---------- 키 → 컬럼 번호 (컴파일 타임 완전 해시) ----------
+// 시드를 바꿔 가며 모든 키가 서로 다른 칸에 떨어지는 시드를 컴파일 중에 찾는다.
+// 런타임 조회는 해시 한 번 + 문자열 비교 한 번.
+constexpr uint32_t SchemaKeyHash(std::string_view key, uint32_t seed)
+{
+	uint32_t h = 2166136261u ^ seed;
+	for (char c : key)
+	{
+		h ^= (unsigned char)c;
+		h *= 16777619u;
+	}
+	return h ^ (h >> 15);
+}
+
+// 키 수의 2배 이상인 2의 거듭제곱 (충돌 없는 시드를 빨리 찾도록 여유를 둔다)
+constexpr size_t SchemaKeySlots(size_t n)
+{
+	size_t s = 4;
+	while (s < n * 2)
+		s <<= 1;
+	return s;
+}
+
+template <size_t N>
+struct SchemaKeyIndex {
+	static constexpr size_t Slots = SchemaKeySlots(N);
+	static constexpr uint8_t Empty = 0xFF;
+
+	uint32_t seed = 0;
+	uint8_t slots[Slots] = {};
+	std::array<std::string_view, N> names = {};
+
+	// 없는 키면 -1
+	constexpr int Find(std::string_view key) const
+	{
+		uint8_t c = slots[SchemaKeyHash(key, seed) & (Slots - 1)];
+		return (c != Empty && names[c] == key) ? c : -1;
+	}
+};
+
+// 이름이 중복되면 시드를 찾지 못해 컴파일 오류가 난다.
+template <size_t N>
+constexpr SchemaKeyIndex<N> MakeSchemaKeyIndex(const std::array<std::string_view, N>& names)
+{
+	static_assert(N < 0xFF, "too many columns");
+	SchemaKeyIndex<N> index{};
+	for (uint32_t seed = 0; seed < (1u << 16); ++seed)
+	{
+		for (size_t s = 0; s < index.Slots; ++s)
+			index.slots[s] = index.Empty;
+		bool ok = true;
+		for (size_t i = 0; i < N && ok; ++i)
+		{
+			uint8_t& slot = index.slots[SchemaKeyHash(names[i], seed) & (index.Slots - 1)];
+			if (slot != index.Empty)
+				ok = false;
+			else
+				slot = (uint8_t)i;
+		}
+		if (ok)
+		{
+			index.seed = seed;
+			index.names = names;
+			return index;
+		}
+	}
+	throw "duplicate column names in schema";
+}
+
+template <class Schema>
+constexpr SchemaKeyIndex<SchemaColumnCount<Schema>()> MakeSchemaKeyIndex()
+{
+	return MakeSchemaKeyIndex(SchemaColumnNames<Schema>());
+}
@@ -0,0 +1,30 @@
+﻿#pragma once
+// TableSchemas.h : 게임 데이터 테이블 스키마 (TableSchema.h 참고)
+// 새 테이블은 Row 구조체와 스키마 하나를 여기에 추가하면
+// TableLoader.h 의 JSON/BIN 로더와 CSVParser 기본 시트 설정이 자동으로 따라온다.
+#include "TableSchema.h"
+#include "ItemBase.h"
+#include "ShopBase.h"
+
+struct ItemSchema {
+	typedef ItemBase Row;
+	static constexpr const char* Sheet = "Item";
+	static constexpr const char* StartCell = "A2";
+	static constexpr auto Columns = std::make_tuple(
+		IntColumn("Idx", &ItemBase::idx),
+		StringColumn("Name", &ItemBase::name),
+		EnumColumn("Type", &ItemBase::type, &ParseItemType),
+		IntColumn("Value", &ItemBase::value),
+		StringColumn("Effect", &ItemBase::effect));
+};
+
+struct ShopSchema {
+	typedef ShopBase Row;
+	static constexpr const char* Sheet = "Shop";
+	static constexpr const char* StartCell = "A2";
+	static constexpr auto Columns = std::make_tuple(
+		IntColumn("ShopId", &ShopBase::shopId),
+		IntColumn("ItemIdx", &ShopBase::itemIdx),
+		IntColumn("Price", &ShopBase::price),
+		IntColumn("Stock", &ShopBase::stock));
+};
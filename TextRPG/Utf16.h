@@ -0,0 +1,158 @@
+﻿#pragma once
+// Utf16.h : UTF-16(LE/BE) → UTF-8 변환
+// wchar_t 를 거치지 않고 바이트에서 바로 UTF-8 로 쓴다(Linux 의 32비트 wchar_t 에서도 같은 결과).
+// - 데이터 파일은 대부분 ASCII(키/숫자/구두점)라, 8유닛씩 SIMD 로 검사해 앞쪽 ASCII 구간을 한 번에 좁혀 쓴다.
+// - 나머지는 유닛 단위. 서로게이트 쌍은 4바이트 문자로 합치고, 짝 없는 서로게이트는 U+FFFD 로 바꾼다.
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define UTF16_SIMD_SSE2 1
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// p[0], p[1] 두 바이트를 유닛 하나로
+inline uint32_t Utf16Unit(const unsigned char* p, bool bigEndian)
+{
+	return bigEndian ? (static_cast<uint32_t>(p[0]) << 8) | p[1] : (static_cast<uint32_t>(p[1]) << 8) | p[0];
+}
+
+inline unsigned Utf16Ctz32(uint32_t x)
+{
+#ifdef _MSC_VER
+	unsigned long idx;
+	_BitScanForward(&idx, x);
+	return static_cast<unsigned>(idx);
+#else
+	return static_cast<unsigned>(__builtin_ctz(x));
+#endif
+}
+
+inline unsigned Utf16Popcount32(uint32_t x)
+{
+	x = x - ((x >> 1) & 0x55555555u);
+	x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+	return static_cast<unsigned>((((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+}
+
+// 유닛 units 개를 UTF-8 로 바꿨을 때의 바이트 수(AppendUtf16AsUtf8 과 같은 규칙).
+// 출력 버퍼를 최악(유닛당 3바이트)으로 잡으면 큰 파일에서 0 채우기/페이지 폴트가 변환보다 비싸서
+// 먼저 정확한 길이를 센다. 서로게이트가 없는 8유닛은 SIMD 로 한 번에 센다.
+inline size_t Utf16ToUtf8Length(const unsigned char* p, size_t units, bool bigEndian)
+{
+	size_t len = 0, i = 0;
+	while (i < units)
+	{
+#ifdef UTF16_SIMD_SSE2
+		if (i + 8 <= units)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i));
+			if (bigEndian)
+				v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+			const __m128i zero = _mm_setzero_si128();
+			__m128i top5 = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800)));
+			__m128i sur = _mm_cmpeq_epi16(top5, _mm_set1_epi16(static_cast<short>(0xD800)));
+			if (!_mm_movemask_epi8(sur))
+			{
+				// 유닛당 3바이트에서 ASCII 면 2, 0x800 미만이면 1 을 뺀다(마스크는 유닛당 2비트)
+				unsigned ascii = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(
+					_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80))), zero)));
+				unsigned below800 = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(top5, zero)));
+				len += 24 - (Utf16Popcount32(ascii) + Utf16Popcount32(below800)) / 2;
+				i += 8;
+				continue;
+			}
+		}
+#endif
+		uint32_t c = Utf16Unit(p + 2 * i++, bigEndian);
+		if (c < 0x80)
+			len += 1;
+		else if (c < 0x800)
+			len += 2;
+		else if (c <= 0xDBFF && c >= 0xD800 && i < units
+			&& (Utf16Unit(p + 2 * i, bigEndian) & 0xFC00) == 0xDC00)
+		{
+			len += 4;
+			++i;
+		}
+		else
+			len += 3; // BMP 또는 짝 없는 서로게이트(U+FFFD)
+	}
+	return len;
+}
+
+// p[0, bytes) 의 UTF-16 을 UTF-8 로 바꿔 out 뒤에 붙인다. 끝의 홀수 바이트는 버린다.
+inline void AppendUtf16AsUtf8(const unsigned char* p, size_t bytes, bool bigEndian, std::string& out)
+{
+	const size_t units = bytes / 2;
+	const size_t base = out.size();
+	out.resize(base + Utf16ToUtf8Length(p, units, bigEndian));
+	char* const start = &out[0];
+	char* w = start + base;
+
+	size_t i = 0;
+	while (i < units)
+	{
+#ifdef UTF16_SIMD_SSE2
+		// 8유닛을 한 번에 보고 앞쪽 ASCII 유닛들을 packus 로 좁혀 쓴다.
+		// 8바이트를 다 쓰고 ASCII 개수만큼만 전진(남은 유닛이 8개 이상이면 남은 출력도 8바이트 이상).
+		// 한글 사이의 공백/따옴표처럼 짧은 ASCII 구간도 이 경로로 처리된다.
+		if (i + 8 <= units)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i));
+			if (bigEndian)
+				v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+			__m128i hi = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80)));
+			unsigned ascii = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(hi, _mm_setzero_si128())));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(w), _mm_packus_epi16(v, v));
+			if (ascii == 0xFFFF)
+			{
+				w += 8;
+				i += 8;
+				continue;
+			}
+			size_t k = Utf16Ctz32(~ascii) / 2; // 유닛당 마스크 2비트
+			w += k;
+			i += k;
+		}
+#endif
+		// ASCII 가 아닌 유닛들(또는 꼬리). 다음 유닛이 ASCII 면 다시 SIMD 로 돌아간다.
+		do
+		{
+			uint32_t c = Utf16Unit(p + 2 * i++, bigEndian);
+			if (c < 0x80)
+			{
+				*w++ = static_cast<char>(c);
+				continue;
+			}
+			if (c < 0x800)
+			{
+				*w++ = static_cast<char>(0xC0 | (c >> 6));
+				*w++ = static_cast<char>(0x80 | (c & 0x3F));
+				continue;
+			}
+			if (c >= 0xD800 && c <= 0xDFFF)
+			{
+				uint32_t lo = (c <= 0xDBFF && i < units) ? Utf16Unit(p + 2 * i, bigEndian) : 0;
+				if (lo >= 0xDC00 && lo <= 0xDFFF)
+				{
+					++i;
+					c = 0x10000 + ((c - 0xD800) << 10) + (lo - 0xDC00);
+					*w++ = static_cast<char>(0xF0 | (c >> 18));
+					*w++ = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+					*w++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+					*w++ = static_cast<char>(0x80 | (c & 0x3F));
+					continue;
+				}
+				c = 0xFFFD; // 짝 없는 서로게이트
+			}
+			*w++ = static_cast<char>(0xE0 | (c >> 12));
+			*w++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+			*w++ = static_cast<char>(0x80 | (c & 0x3F));
+		} while (i < units && Utf16Unit(p + 2 * i, bigEndian) >= 0x80);
+	}
+}